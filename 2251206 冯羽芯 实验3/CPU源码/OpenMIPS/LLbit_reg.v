@@ -4,26 +4,54 @@ module LLbit_reg(
        input wire      clk, 
        input wire      rst, 
         
-       // 쳣ǷΪ 1 ʾ쳣Ϊ 0 ʾû쳣 
+       // 异常是否发生，为 1 表示异常发生，为 0 表示没有异常 
        input wire      flush, 
         
-       // д 
+       // 写操作 
        input wire      LLbit_i, 
        input wire      we, 
+       input wire[`RegBus] LLaddr_i,     // ll 指令的链接地址
+
+       // 来自总线侧的监听信号：其它主设备完成了一次写操作
+       input wire      snoop_we_i,
+       input wire[`RegBus] snoop_addr_i,
         
-       // LLbit Ĵֵ 
-       output reg      LLbit_o       
+       // LLbit 寄存器的值 
+       output wire     LLbit_o
 );
 
+    reg          LLbit;      // 链接标志
+    reg[`RegBus] LLaddr;     // 独占监视器记录的链接地址
+    wire         snoop_hit;  // 其它主设备写了被监视的粒度
+
+    // 其它主设备对同一粒度的写操作会破坏 ll/sc 的原子性，此时清除链接
+    assign snoop_hit = (snoop_we_i == `WriteEnable) &&
+                       (snoop_addr_i[`LLGranuleBus] == LLaddr[`LLGranuleBus]);
+
+    // 监听命中的当拍就屏蔽 LLbit，使同一周期到达访存阶段的 sc 也会失败
+    assign LLbit_o = LLbit & ~snoop_hit;
+
 always @ (posedge clk) begin 
     if (rst == `RstEnable) begin 
-        LLbit_o <= 1'b0; 
+        LLbit  <= 1'b0;
+        LLaddr <= `ZeroWord;
     end 
-    else if((flush == 1'b1)) begin // 쳣ô LLbit_o Ϊ 0 
-        LLbit_o <= 1'b0; 
+    else if((flush == 1'b1)) begin // 如果异常发生，那么设置 LLbit 为 0
+        LLbit  <= 1'b0;
     end 
     else if((we == `WriteEnable)) begin 
-        LLbit_o <= LLbit_i; 
+        if(LLbit_i == 1'b1) begin  // ll 指令，记录新的链接地址
+            LLaddr <= LLaddr_i;
+            // ll 读出数据之后、回写之前若已被其它主设备改写，链接同样无效
+            LLbit  <= ~((snoop_we_i == `WriteEnable) &&
+                        (snoop_addr_i[`LLGranuleBus] == LLaddr_i[`LLGranuleBus]));
+        end
+        else begin                 // sc 指令，清除链接
+            LLbit  <= 1'b0;
+        end
+    end 
+    else if(snoop_hit == 1'b1) begin
+        LLbit  <= 1'b0;
     end 
 end
 
@@ -1,50 +1,50 @@
-//*******************         ȫֵĺ궨        *************************** 
-`define RstEnable            1'b1                // λźЧ 
-`define RstDisable           1'b0                // λźЧ 
-`define ZeroWord             32'h00000000        // 32 λֵ 0 
-`define WriteEnable          1'b1                // ʹд 
-`define WriteDisable         1'b0                // ֹд 
-`define ReadEnable           1'b1                // ʹܶ 
-`define ReadDisable          1'b0                // ֹ 
-`define AluOpBus             7:0                 // ׶ε aluop_o Ŀ 
-`define AluSelBus            2:0                 // ׶ε alusel_o Ŀ 
-`define InstValid            1'b0                // ָЧ 
-`define InstInvalid          1'b1                // ָЧ 
-`define True_v               1'b1                // ߼"" 
-`define False_v              1'b0                // ߼"" 
-`define ChipEnable           1'b1                // оƬʹ 
-`define ChipDisable          1'b0                // оƬֹ 
-
-`define Stop                 1'b1                // ˮͣ 
-`define NoStop               1'b0                // ˮ߼
-
-`define Branch               1'b1                // ת 
-`define NotBranch            1'b0                // ת
-
-`define InDelaySlot          1'b1                // ӳٲ 
-`define NotInDelaySlot       1'b0                // ӳٲ
+//*******************         全局的宏定义        *************************** 
+`define RstEnable            1'b1                // 复位信号有效 
+`define RstDisable           1'b0                // 复位信号无效 
+`define ZeroWord             32'h00000000        // 32 位的数值 0 
+`define WriteEnable          1'b1                // 使能写 
+`define WriteDisable         1'b0                // 禁止写 
+`define ReadEnable           1'b1                // 使能读 
+`define ReadDisable          1'b0                // 禁止读 
+`define AluOpBus             7:0                 // 译码阶段的输出 aluop_o 的宽度 
+`define AluSelBus            2:0                 // 译码阶段的输出 alusel_o 的宽度 
+`define InstValid            1'b0                // 指令有效 
+`define InstInvalid          1'b1                // 指令无效 
+`define True_v               1'b1                // 逻辑"真" 
+`define False_v              1'b0                // 逻辑"假" 
+`define ChipEnable           1'b1                // 芯片使能 
+`define ChipDisable          1'b0                // 芯片禁止 
+
+`define Stop                 1'b1                // 流水线暂停 
+`define NoStop               1'b0                // 流水线继续
+
+`define Branch               1'b1                // 转移 
+`define NotBranch            1'b0                // 不转移
+
+`define InDelaySlot          1'b1                // 在延迟槽中 
+`define NotInDelaySlot       1'b0                // 不在延迟槽中
  
-//*********************   ָйصĺ궨  ***************************** 
+//*********************   与具体指令有关的宏定义  ***************************** 
 `define EXE_NOP  6'b000000             // nop 
  
-`define EXE_AND  6'b100100             // and ָĹ 
-`define EXE_OR   6'b100101             // or ָĹ 
-`define EXE_XOR  6'b100110             // xor ָĹ 
-`define EXE_NOR  6'b100111             // nor ָĹ 
-`define EXE_ANDI 6'b001100             // andi ָָ 
-`define EXE_ORI  6'b001101             // ori ָָ 
-`define EXE_XORI 6'b001110             // xori ָָ 
-`define EXE_LUI  6'b001111             // lui ָָ 
+`define EXE_AND  6'b100100             // and 指令的功能码 
+`define EXE_OR   6'b100101             // or 指令的功能码 
+`define EXE_XOR  6'b100110             // xor 指令的功能码 
+`define EXE_NOR  6'b100111             // nor 指令的功能码 
+`define EXE_ANDI 6'b001100             // andi 指令的指令码 
+`define EXE_ORI  6'b001101             // ori 指令的指令码 
+`define EXE_XORI 6'b001110             // xori 指令的指令码 
+`define EXE_LUI  6'b001111             // lui 指令的指令码 
  
-`define EXE_SLL  6'b000000             // sll ָĹ 
-`define EXE_SLLV 6'b000100             // sllv ָĹ 
-`define EXE_SRL  6'b000010             // sra ָĹ 
-`define EXE_SRLV 6'b000110             // srlv ָĹ 
-`define EXE_SRA  6'b000011             // sra ָĹ 
-`define EXE_SRAV 6'b000111             // srav ָĹ 
+`define EXE_SLL  6'b000000             // sll 指令的功能码 
+`define EXE_SLLV 6'b000100             // sllv 指令的功能码 
+`define EXE_SRL  6'b000010             // sra 指令的功能码 
+`define EXE_SRLV 6'b000110             // srlv 指令的功能码 
+`define EXE_SRA  6'b000011             // sra 指令的功能码 
+`define EXE_SRAV 6'b000111             // srav 指令的功能码 
  
-`define EXE_SYNC  6'b001111            // sync ָĹ 
-`define EXE_PREF  6'b110011            // pref ָָ 
+`define EXE_SYNC  6'b001111            // sync 指令的功能码 
+`define EXE_PREF  6'b110011            // pref 指令的指令码 
 
 `define EXE_MOVZ  6'b001010 
 `define EXE_MOVN  6'b001011 
@@ -79,7 +79,7 @@
 `define EXE_DIV    6'b011010 
 `define EXE_DIVU   6'b011011
 
-// йתָ
+// 有关转移指令
 `define EXE_J      6'b000010 
 `define EXE_JAL    6'b000011 
 `define EXE_JALR   6'b001001 
@@ -93,7 +93,7 @@
 `define EXE_BLTZAL 5'b10000 
 `define EXE_BNE    6'b000101
 
-// 洢й
+// 与存储有关
 `define EXE_LB   6'b100000 
 `define EXE_LBU  6'b100100 
 `define EXE_LH   6'b100001 
@@ -214,6 +214,8 @@
 
 `define EXE_MFC0_OP    8'b01011101
 `define EXE_MTC0_OP    8'b01100000
+`define EXE_DI_OP      8'b01100001
+`define EXE_EI_OP      8'b01100010
 
 `define EXE_SYSCALL_OP 8'b00001100
 `define EXE_BREAK_OP   8'b00001101
@@ -246,7 +248,7 @@
 
 `define EXE_RES_NOP         3'b000
 
-//*********************   ģصĺ궨        **********************
+//*********************   与除法模块相关的宏定义        **********************
 `define DivFree            2'b00 
 `define DivByZero          2'b01 
 `define DivOn              2'b10 
@@ -257,31 +259,61 @@
 `define DivStop            1'b0
  
  
-//*********************   ָ洢ROMйصĺ궨   ********************** 
-`define InstAddrBus          31:0                // ROM ĵַ߿ 
-`define InstBus              31:0                // ROM ߿ 
-`define InstMemNum           131071              // ROM ʵʴСΪ 128KB 
-`define InstMemNumLog2       17                  // ROM ʵʹõĵַ߿ 
+//*********************   与指令存储器ROM有关的宏定义   ********************** 
+`define InstAddrBus          31:0                // ROM 的地址总线宽度 
+`define InstBus              31:0                // ROM 的数据总线宽度 
+`define InstMemNum           131071              // ROM 的实际大小为 128KB 
+`define InstMemNumLog2       17                  // ROM 实际使用的地址线宽度 
  
-//*********************  ݴ洢 RAM йصĺ궨 ***********************
-`define DataAddrBus    31:0           // ַ߿ 
-`define DataBus        31:0           // ߿ 
-`define DataMemNum     131071         // RAM ĴСλ֣4 ֽڣ˴ 128K word  
-// ԭ 131071 ̫ûۺͨԸСˣûӰ
-`define DataMemNumLog2 17             // ʵʹõĵַ 
-`define ByteWidth      7:0            // һֽڵĿȣ 8bit
+//*********************  与数据存储器 RAM 有关的宏定义 ***********************
+`define DataAddrBus    31:0           // 地址总线宽度 
+`define DataBus        31:0           // 数据总线宽度 
+`define DataMemNum     131071         // RAM 的大小，单位是字（4 字节），此处是 128K word  
+// 原来是 131071 由于太大了没法综合通过，所以改小了，没有影响
+`define DataMemNumLog2 17             // 实际使用的地址宽度 
+`define ByteWidth      7:0            // 一个字节的宽度，是 8bit
  
-//*********************  ͨüĴRegfileйصĺ궨   ******************* 
-`define RegAddrBus           4:0                 // Regfile ģĵַ߿ 
-`define RegBus               31:0                // Regfile ģ߿ 
-`define RegWidth             32                  // ͨüĴĿ 
-`define DoubleRegWidth       64                  // ͨüĴĿ 
-`define DoubleRegBus         63:0                // ͨüĴ߿ 
-`define RegNum               32                  // ͨüĴ 
-`define RegNumLog2           5                   // ѰַͨüĴʹõĵַλ 
+//*********************  与通用寄存器Regfile有关的宏定义   ******************* 
+`define RegAddrBus           4:0                 // Regfile 模块的地址线宽度 
+`define RegBus               31:0                // Regfile 模块的数据线宽度 
+`define RegWidth             32                  // 通用寄存器的宽度 
+`define DoubleRegWidth       64                  // 两倍的通用寄存器的宽度 
+`define DoubleRegBus         63:0                // 两倍的通用寄存器的数据线宽度 
+`define RegNum               32                  // 通用寄存器的数量 
+`define RegNumLog2           5                   // 寻址通用寄存器使用的地址位数 
 `define NOPRegAddr           5'b00000
 
-// CP0 иĴĵַ
+//*********************  与 LL/SC 独占监视有关的宏定义   ********************* 
+`define LLGranuleBus         31:4                // 独占监视的粒度为 16 字节，比较地址的高 28 位
+
+//*********************  与紧耦合存储器 TCM 有关的宏定义   ********************* 
+// TCM 放在 DDR2 地址窗口（0x0XXXXXXX）的顶端，与程序位于同一个 256MB 区域，j/jal 可以直接到达
+// 修改基地址或大小时要同时修改操作系统源码 ucosii_OpenMIPS/ram.ld 中 itcm、dtcm 的 ORIGIN 和 LENGTH
+`define ITCMBaseAddr         32'h0FFF0000        // ITCM 的基地址
+`define ITCMAddrMask         32'hFFFFE000        // ITCM 的地址掩码，大小为 8KB
+`define ITCMNumLog2          11                  // ITCM 的字数取对数，2K word
+`define DTCMBaseAddr         32'h0FFF8000        // DTCM 的基地址
+`define DTCMAddrMask         32'hFFFFE000        // DTCM 的地址掩码，大小为 8KB
+`define DTCMNumLog2          11                  // DTCM 的字数取对数，2K word
+
+//*********************  与复位、片上启动 ROM 有关的宏定义   ********************* 
+// 定义 BOOT_ROM 时例化片上启动 ROM，复位后从 0x40000000 执行 BootLoader，否则与原来一样从 Flash 启动。
+// 打开前要把 bootloader/ram.ld 的 ORIGIN 改为 0x40000000，make 生成 BootLoader.data 并加入工程
+// `define BOOT_ROM 
+`ifdef BOOT_ROM
+`define ResetVector          32'h40000000        // 复位后第一条指令的地址：片上启动 ROM
+`else
+`define ResetVector          32'h30000000        // 复位后第一条指令的地址：Flash
+`endif
+`define BootRomNumLog2       8                   // 启动 ROM 的字数取对数，256 word（1KB），可以放下 0x300 字节的 BootLoader
+`define BootRomInitFile      "BootLoader.data"   // 启动 ROM 的初始化文件，由 bootloader 目录下的 make 生成
+
+//*********************  与总线互联有关的宏定义   ********************* 
+// 定义 WB_LITE_INTERCON 时用精简的 wb_lite_intercon 代替 wb_conmax_top，每次总线访问少 2 个周期 
+// `define WB_LITE_INTERCON 
+`define WBLiteRegistered     0                   // 为 1 时 wb_lite_intercon 在请求路径上加一级寄存器，每次访问多 1 个周期 
+
+//定义 CP0 中各个寄存器的地址
 `define CP0_REG_COUNT      5'b01001  
 `define CP0_REG_COMPARE    5'b01011  
 `define CP0_REG_STATUS     5'b01100  
@@ -292,7 +324,7 @@
 `define InterruptAssert    1'b1 
 `define InterruptNotAssert 1'b0
 
-// 쳣
+// 异常处理新增
 // `define InstValid          1'b0 
 // `define InstInvalid        1'b1 
 // `define InDelaySlot        1'b1 
@@ -304,6 +336,6 @@
 `define TrapNotAssert      1'b0
 
 /*********************** Wishbone ************************/
-`define WB_IDLE           2'b00    // ״̬ 
-`define WB_BUSY           2'b01    // æ״̬ 
-`define WB_WAIT_FOR_STALL 2'b11    // ȴͣ״̬ 
\ No newline at end of file
+`define WB_IDLE           2'b00    // 空闲状态 
+`define WB_BUSY           2'b01    // 总线忙状态 
+`define WB_WAIT_FOR_STALL 2'b11    // 等待暂停结束状态 
\ No newline at end of file
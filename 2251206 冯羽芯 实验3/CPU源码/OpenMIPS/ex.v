@@ -6,7 +6,7 @@ module ex(
     input wire[31:0]           excepttype_i, 
     input wire[`RegBus]        current_inst_address_i,
     
-    // ׶͵ִн׶εϢ 
+    // 译码阶段送到执行阶段的信息 
     input wire[`AluOpBus]      aluop_i, 
     input wire[`AluSelBus]     alusel_i, 
     input wire[`RegBus]        reg1_i, 
@@ -14,60 +14,60 @@ module ex(
     input wire[`RegAddrBus]    wd_i, 
     input wire                 wreg_i, 
     
-    // HILO ģ HILO Ĵֵ 
+    // HILO 模块给出的 HI、LO 寄存器的值 
     input wire[`RegBus]           hi_i, 
     input wire[`RegBus]           lo_i, 
     
-    // д׶εָǷҪд HILOڼ HILO Ĵ 
+    // 回写阶段的指令是否要写 HI、LO，用于检测 HI、LO 寄存器带来的数据相关问题 
     input wire[`RegBus]           wb_hi_i, 
     input wire[`RegBus]           wb_lo_i, 
     input wire                    wb_whilo_i, 
     
-    // ô׶εָǷҪд HILOڼ HILO Ĵ 
+    // 访存阶段的指令是否要写 HI、LO，用于检测 HI、LO 寄存器带来的数据相关问题 
     input wire[`RegBus]           mem_hi_i, 
     input wire[`RegBus]           mem_lo_i, 
     input wire                    mem_whilo_i, 
     
-    input wire[`DoubleRegBus]     hilo_temp_i,   // һִڵõĳ˷
-    input wire[1:0]               cnt_i,         // ǰִн׶εĵڼʱ
+    input wire[`DoubleRegBus]     hilo_temp_i,   // 第一个执行周期得到的乘法结果
+    input wire[1:0]               cnt_i,         // 当前处于执行阶段的第几个时钟周期
     
-    input wire[`DoubleRegBus]     div_result_i,  // Գģ
+    input wire[`DoubleRegBus]     div_result_i,  // 来自除法模块的输入
     input wire                    div_ready_i,
     
-    // ִн׶εתָҪķصַ 
+    // 处于执行阶段的转移指令要保存的返回地址 
     input wire[`RegBus]           link_address_i, 
     
-    // ǰִн׶εָǷλӳٲ 
+    // 当前执行阶段的指令是否位于延迟槽 
     input wire                    is_in_delayslot_i,
     
-    // ǰִн׶εָ
+    // 当前处于执行阶段的指令
     input wire[`RegBus]           inst_i,
     
-    // ô׶εָǷҪд CP0 еļĴ 
+    // 访存阶段的指令是否要写 CP0 中的寄存器，用来检测数据相关 
     input wire                     mem_cp0_reg_we, 
     input wire[4:0]                mem_cp0_reg_write_addr, 
     input wire[`RegBus]            mem_cp0_reg_data, 
   
-    // д׶εָǷҪд CP0 еļĴҲ 
+    // 回写阶段的指令是否要写 CP0 中的寄存器，也是用来检测数据相关 
     input wire                     wb_cp0_reg_we, 
     input wire[4:0]                wb_cp0_reg_write_addr, 
     input wire[`RegBus]            wb_cp0_reg_data, 
  
-    //  CP0 ֱڶȡָĴֵ 
+    // 与 CP0 直接相连，用于读取其中指定寄存器的值 
     input wire[`RegBus]            cp0_reg_data_i, 
     output reg[4:0]                cp0_reg_read_addr_o, 
  
-    // ˮһݣд CP0 еָĴ 
+    // 向流水线下一级传递，用于写 CP0 中的指定寄存器 
     output reg                     cp0_reg_we_o, 
     output reg[4:0]                cp0_reg_write_addr_o, 
     output reg[`RegBus]            cp0_reg_data_o,
     
-    // ִн׶εָ HILO Ĵд 
+    // 处于执行阶段的指令对 HI、LO 寄存器的写操作请求 
     output reg[`RegBus]            hi_o, 
     output reg[`RegBus]            lo_o, 
     output reg                     whilo_o,
     
-    // ִеĽ 
+    // 执行的结果 
     output reg[`RegAddrBus]    wd_o, 
     output reg                 wreg_o, 
     output reg[`RegBus]        wdata_o,
@@ -75,7 +75,7 @@ module ex(
     output reg[`DoubleRegBus]  hilo_temp_o, 
     output reg[1:0]            cnt_o, 
     
-    // ģ
+    // 到除法模块的输出
     output reg[`RegBus]        div_opdata1_o, 
     output reg[`RegBus]        div_opdata2_o, 
     output reg                 div_start_o, 
@@ -86,69 +86,69 @@ module ex(
     output wire[`RegBus]       mem_addr_o, 
     output wire[`RegBus]       reg2_o,
     
-    output wire[31:0]          excepttype_o,           // ׶Ρִн׶ռ쳣Ϣ
+    output wire[31:0]          excepttype_o,           // 译码阶段、执行阶段收集到的异常信息
     output wire                is_in_delayslot_o, 
     output wire[`RegBus]       current_inst_address_o, 
     
     output reg		           stallreq       			
 ); 
 
-    reg[`RegBus] logicout;       // ߼Ľ 
-    reg[`RegBus] shiftres;       // λ 
-    reg[`RegBus] moveres;        // ƶĽ 
-    reg[`RegBus] HI;             //  HI Ĵֵ 
-    reg[`RegBus] LO;             //  LO Ĵֵ
-    
-    wire          ov_sum;           // 
-    wire          reg1_eq_reg2;     // һǷڵڶ 
-    wire          reg1_lt_reg2;     // һǷСڵڶ 
-    reg[`RegBus]  arithmeticres;    // Ľ 
-    wire[`RegBus] reg2_i_mux;       // ĵڶ reg2_i Ĳ 
-    wire[`RegBus] reg1_i_not;       // ĵһ reg1_i ȡֵ 
-    wire[`RegBus] result_sum;       // ӷ 
-    wire[`RegBus] opdata1_mult;     // ˷еı 
-    wire[`RegBus] opdata2_mult;     // ˷еĳ 
-    wire[`DoubleRegBus] hilo_temp;  // ʱ˷Ϊ 64 λ 
+    reg[`RegBus] logicout;       // 保存逻辑运算的结果 
+    reg[`RegBus] shiftres;       // 保存移位运算结果 
+    reg[`RegBus] moveres;        // 移动操作的结果 
+    reg[`RegBus] HI;             // 保存 HI 寄存器的最新值 
+    reg[`RegBus] LO;             // 保存 LO 寄存器的最新值
+    
+    wire          ov_sum;           // 保存溢出情况
+    wire          reg1_eq_reg2;     // 第一个操作数是否等于第二个操作数 
+    wire          reg1_lt_reg2;     // 第一个操作数是否小于第二个操作数 
+    reg[`RegBus]  arithmeticres;    // 保存算术运算的结果 
+    wire[`RegBus] reg2_i_mux;       // 保存输入的第二个操作数 reg2_i 的补码 
+    wire[`RegBus] reg1_i_not;       // 保存输入的第一个操作数 reg1_i 取反后的值 
+    wire[`RegBus] result_sum;       // 保存加法结果 
+    wire[`RegBus] opdata1_mult;     // 乘法操作中的被乘数 
+    wire[`RegBus] opdata2_mult;     // 乘法操作中的乘数 
+    wire[`DoubleRegBus] hilo_temp;  // 临时保存乘法结果，宽度为 64 位 
     
     reg[`DoubleRegBus]  hilo_temp1;
     
-    reg [`DoubleRegBus] mulres;     // ˷Ϊ 64 λ
+    reg [`DoubleRegBus] mulres;     // 保存乘法结果，宽度为 64 位
     
     reg           stallreq_for_madd_msub;
-    reg           stallreq_for_div;       // Ƿڳ㵼ˮͣ
+    reg           stallreq_for_div;       // 是否由于除法运算导致流水线暂停
     
-    // aluop_o ᴫݵô׶Σʱȷء洢 
+    // aluop_o 会传递到访存阶段，届时将利用其确定加载、存储类型 
     assign aluop_o = aluop_i;
     
-    // mem_addr_o ᴫݵô׶ΣǼء洢ָӦĴ洢ַ˴ reg1_i
-    // Ǽء洢ָеַΪ base ͨüĴֵinst_i[15:0] ָе 
-    // offsetͨ mem_addr_o ļ㣬ҲΪҪ׶IDģ 
-    // ӿ inst_o
+    // mem_addr_o 会传递到访存阶段，是加载、存储指令对应的存储器地址，此处的 reg1_i
+    // 就是加载、存储指令中地址为 base 的通用寄存器的值，inst_i[15:0] 就是指令中的 
+    // offset。通过 mem_addr_o 的计算，读者也可以明白为何要在译码阶段ID模块新增输 
+    // 出接口 inst_o
     assign mem_addr_o = reg1_i + {{16{inst_i[15]}}, inst_i[15:0]};
     
-    // reg2_i Ǵ洢ָҪ洢ݣ lwllwr ָҪصĿļĴԭʼֵ 
-    // ֵͨ reg2_o ӿڴݵô׶
+    // reg2_i 是存储指令要存储的数据，或者 lwl、lwr 指令要加载到的目的寄存器的原始值， 
+    // 将该值通过 reg2_o 接口传递到访存阶段
     assign reg2_o = reg2_i;
     
-    reg trapassert;            // ʾǷ쳣 
-    reg ovassert;              // ʾǷ쳣 
+    reg trapassert;            // 表示是否有自陷异常 
+    reg ovassert;              // 表示是否有溢出异常 
     
-    // ִн׶쳣Ϣ׶ε쳣Ϣ쳣쳣Ϣ 
-    // е 10 bit ʾǷ쳣 11 bit ʾǷ쳣 
+    // 执行阶段输出的异常信息就是译码阶段的异常信息加上自陷异常、溢出异常的信息， 
+    // 其中第 10 bit 表示是否有自陷异常，第 11 bit 表示是否有溢出异常 
     assign excepttype_o = {excepttype_i[31:12], ovassert, trapassert, excepttype_i[9:8], 8'h00}; 
  
-    // is_in_delayslot_i ʾǰָǷӳٲ
+    // is_in_delayslot_i 表示当前指令是否在延迟槽中
     assign is_in_delayslot_o = is_in_delayslot_i; 
  
-    // ǰִн׶ָĵַ 
+    // 当前处于执行阶段指令的地址 
     assign current_inst_address_o = current_inst_address_i;
     
 /**************************************************************** 
-***********           һΣ5ֵ          ********* 
+***********           第一段：计算以下5个变量的值          ********* 
 *****************************************************************/ 
  
-        //1ǼзűȽзָô reg2_i_mux ڵڶ 
-        //    reg2_i Ĳ룬 reg2_i_mux ͵ڵڶ reg2_i 
+        //（1）如果是减法或者有符号比较运算或有符号自陷指令，那么 reg2_i_mux 等于第二个操作数 
+        //    reg2_i 的补码，否则 reg2_i_mux 就等于第二个操作数 reg2_i 
         assign reg2_i_mux = ((aluop_i == `EXE_SUB_OP)  ||  
                              (aluop_i == `EXE_SUBU_OP) || 
                              (aluop_i == `EXE_SLT_OP)  ||
@@ -158,32 +158,32 @@ module ex(
                              (aluop_i == `EXE_TGEI_OP)) ?
                             (~reg2_i) + 1 : reg2_i;
                             
-        //2 
-        //    AǼӷ㣬ʱ reg2_i_mux ǵڶ reg2_i 
-        //        result_sum ǼӷĽ 
-        //    BǼ㣬ʱ reg2_i_mux ǵڶ reg2_i Ĳ룬 
-        //        result_sum ǼĽ 
-        //    CзűȽзָʱ reg2_i_mux Ҳǵڶ reg2_i  
-        //       Ĳ룬 result_sum ҲǼĽͨжϼ 
-        //       ĽǷС㣬жϵһ reg1_i ǷСڵڶ 
-        //        reg2_i 
+        //（2）分三种情况： 
+        //    A．如果是加法运算，此时 reg2_i_mux 就是第二个操作数 reg2_i， 
+        //       所以 result_sum 就是加法运算的结果 
+        //    B．如果是减法运算，此时 reg2_i_mux 是第二个操作数 reg2_i 的补码， 
+        //       所以 result_sum 就是减法运算的结果 
+        //    C．如果是有符号比较运算或有符号自陷指令，此时 reg2_i_mux 也是第二个操作数 reg2_i  
+        //       的补码，所以 result_sum 也是减法运算的结果，可以通过判断减法 
+        //       的结果是否小于零，进而判断第一个操作数 reg1_i 是否小于第二个操 
+        //       作数 reg2_i 
         assign result_sum = reg1_i + reg2_i_mux; 
        
-        //3Ƿӷָaddaddiָsubִеʱ 
-        //    ҪжǷ֮һʱ 
-        //    Areg1_iΪreg2_i_muxΪ֮Ϊ 
-        //    Breg1_iΪreg2_i_muxΪ֮Ϊ 
+        //（3）计算是否溢出，加法指令（add和addi）、减法指令（sub）执行的时候， 
+        //    需要判断是否溢出，满足以下两种情况之一时，有溢出： 
+        //    A．reg1_i为正数，reg2_i_mux为正数，但是两者之和为负数 
+        //    B．reg1_i为负数，reg2_i_mux为负数，但是两者之和为正数 
         assign ov_sum = ((!reg1_i[31] && !reg2_i_mux[31]) && result_sum[31]) 
                         ||((reg1_i[31] && reg2_i_mux[31]) && (!result_sum[31]));
                         
-        //4 1 ǷСڲ 2 
-        //    Aaluop_i Ϊ EXE_SLT_OP ʾзűȽз쳣ָʱַ 3  
-        //       A1reg1_i Ϊreg2_i ΪȻ reg1_i С reg2_i
-        //       A2reg1_i Ϊreg2_i Ϊ reg1_i ȥ reg2_i ֵС 0 
-        //            result_sum ΪʱҲ reg1_i С reg2_i 
-        //       A3reg1_i Ϊreg2_i Ϊ reg1_i ȥ reg2_i ֵС 0 
-        //            result_sum ΪʱҲ reg1_i С reg2_i 
-        //    B. ޷Ƚϻ޷쳣ָʱֱʹñȽȽ reg1_i  reg2_i 
+        //（4）计算操作数 1 是否小于操作数 2，分两种情况： 
+        //    A．aluop_i 为 EXE_SLT_OP 表示有符号比较运算或者有符号自陷异常指令，此时又分 3 种情况 
+        //       A1．reg1_i 为负数、reg2_i 为正数，显然 reg1_i 小于 reg2_i
+        //       A2．reg1_i 为正数、reg2_i 为正数，并且 reg1_i 减去 reg2_i 的值小于 0 
+        //           （即 result_sum 为负），此时也有 reg1_i 小于 reg2_i 
+        //       A3．reg1_i 为负数、reg2_i 为负数，并且 reg1_i 减去 reg2_i 的值小于 0 
+        //           （即 result_sum 为负），此时也有 reg1_i 小于 reg2_i 
+        //    B. 无符号数比较或者无符号自陷异常指令的时候，直接使用比较运算符比较 reg1_i 与 reg2_i 
         assign reg1_lt_reg2 = ((aluop_i == `EXE_SLT_OP)  ||
                                (aluop_i == `EXE_TLT_OP)  || 
                                (aluop_i == `EXE_TLTI_OP) || 
@@ -194,11 +194,11 @@ module ex(
                                (reg1_i[31] &&  reg2_i[31] && result_sum[31])) 
                               :(reg1_i < reg2_i);
                               
-        //5Բ 1 λȡ reg1_i_not 
+        //（5）对操作数 1 逐位取反，赋给 reg1_i_not 
         assign reg1_i_not = ~reg1_i; 
         
 /**************************************************************** 
-****    ڶΣݲͬͣarithmeticresֵ  **** 
+****    第二段：依据不同的算术运算类型，给arithmeticres变量赋值  **** 
 *****************************************************************/
 
 always @ (*) begin 
@@ -206,17 +206,17 @@ always @ (*) begin
         arithmeticres <= `ZeroWord; 
     end 
     else begin 
-        case (aluop_i)                            // aluop_i  
+        case (aluop_i)                            // aluop_i 就是运算类型 
             `EXE_SLT_OP, `EXE_SLTU_OP: begin 
-                arithmeticres <= reg1_lt_reg2 ;   // Ƚ 
+                arithmeticres <= reg1_lt_reg2 ;   // 比较运算 
             end 
             `EXE_ADD_OP, `EXE_ADDU_OP, `EXE_ADDI_OP, `EXE_ADDIU_OP: begin        
-                arithmeticres <= result_sum;      // ӷ 
+                arithmeticres <= result_sum;      // 加法运算 
             end 
             `EXE_SUB_OP, `EXE_SUBU_OP: begin 
-                arithmeticres <= result_sum;      //  
+                arithmeticres <= result_sum;      // 减法运算 
             end   
-            `EXE_CLZ_OP: begin                    //  clz 
+            `EXE_CLZ_OP: begin                    // 计数运算 clz 
                 arithmeticres <= reg1_i[31] ? 0 : reg1_i[30] ? 1 : 
                                  reg1_i[29] ? 2 : reg1_i[28] ? 3 : 
                                  reg1_i[27] ? 4 : reg1_i[26] ? 5 : 
@@ -234,7 +234,7 @@ always @ (*) begin
                                  reg1_i[3]  ? 28 : reg1_i[2]  ? 29 : 
                                  reg1_i[1]  ? 30 : reg1_i[0]  ? 31 : 32 ; 
             end 
-            `EXE_CLO_OP: begin       //  clo 
+            `EXE_CLO_OP: begin       // 计数运算 clo 
                 arithmeticres <= (reg1_i_not[31] ? 0 :  
                                   reg1_i_not[29] ? 2 : 
                                   reg1_i_not[28] ? 3 :  
@@ -275,14 +275,14 @@ always @ (*) begin
 end
 
 /**************************************************************** 
-************            Σг˷          ************* 
+************            第三段：进行乘法运算          ************* 
 *****************************************************************/ 
 
-    //1ȡó˷ıзų˷ұǸôȡ 
+    //（1）取得乘法运算的被乘数，如果是有符号乘法且被乘数是负数，那么取补码 
     
-    //1ȡó˷ıָ maddmsub зų˷һ 
-    //     reg1_i Ǹôȡ reg1_i ĲΪֱ֮ 
-    //    ʹ reg1_i Ϊ
+    //（1）取得乘法操作的被乘数，指令 madd、msub 都是有符号乘法，如果第一个 
+    //    操作数 reg1_i 是负数，那么取 reg1_i 的补码作为被乘数；反之，直接 
+    //    使用 reg1_i 作为被乘数
     
     assign opdata1_mult = (((aluop_i == `EXE_MUL_OP) || 
                             (aluop_i == `EXE_MULT_OP) ||
@@ -290,11 +290,11 @@ end
                             (aluop_i == `EXE_MSUB_OP)) && 
                             (reg1_i[31] == 1'b1)) ? (~reg1_i + 1) : reg1_i; 
                             
-    //2ȡó˷ĳзų˷ҳǸôȡ 
+    //（2）取得乘法运算的乘数，如果是有符号乘法且乘数是负数，那么取补码 
     
-    //2ȡó˷ĳָ maddmsub зų˷ڶ 
-    //     reg2_i Ǹôȡ reg2_i ĲΪֱ֮ 
-    //    ʹ reg2_i Ϊ
+    //（2）取得乘法操作的乘数，指令 madd、msub 是有符号乘法，如果第二个 
+    //    操作数 reg2_i 是负数，那么取 reg2_i 的补码作为乘数；反之，直接 
+    //    使用 reg2_i 作为乘数
     
     assign opdata2_mult = (((aluop_i == `EXE_MUL_OP) || 
                             (aluop_i == `EXE_MULT_OP) ||
@@ -302,17 +302,17 @@ end
                             (aluop_i == `EXE_MSUB_OP)) 
                             && (reg2_i[31] == 1'b1)) ? (~reg2_i + 1) : reg2_i;
                             
-    //3õʱ˷ڱ hilo_temp  
+    //（3）得到临时乘法结果，保存在变量 hilo_temp 中 
     assign hilo_temp = opdata1_mult * opdata2_mult;
     
-    //4ʱ˷յĳ˷ڱ mulres УҪ㣺 
-    //    Aзų˷ָ multmulôҪʱ˷£ 
-    //       A1һһôҪʱ˷ 
-    //          hilo_temp 룬Ϊյĳ˷ mulres 
-    //       A2ͬţô hilo_temp ֵΪյ 
-    //          ˷ mulres 
-    //    B޷ų˷ָ multuô hilo_temp ֵΪյĳ˷, 
-    //        mulres 
+    //（4）对临时乘法结果进行修正，最终的乘法结果保存在变量 mulres 中，主要有两点： 
+    //    A．如果是有符号乘法指令 mult、mul，那么需要修正临时乘法结果，如下： 
+    //       A1．如果被乘数与乘数两者一正一负，那么需要对临时乘法结果 
+    //          hilo_temp 求补码，作为最终的乘法结果，赋给变量 mulres。 
+    //       A2．如果被乘数与乘数同号，那么 hilo_temp 的值就作为最终的 
+    //          乘法结果，赋给变量 mulres。 
+    //    B．如果是无符号乘法指令 multu，那么 hilo_temp 的值就作为最终的乘法结果, 
+    //       赋给变量 mulres 
     always @ (*) begin 
         if(rst == `RstEnable) begin 
             mulres <= {`ZeroWord,`ZeroWord}; 
@@ -334,7 +334,7 @@ end
     end
     
 /**************************************************************** 
-*******    DIV ģϢȡ DIV ģĽ   ****** 
+*******   输出 DIV 模块控制信息，获取 DIV 模块给出的结果   ****** 
 *****************************************************************/ 
 
 always @ (*) begin 
@@ -352,20 +352,20 @@ always @ (*) begin
         div_start_o      <= `DivStop; 
         signed_div_o     <= 1'b0;        
         case (aluop_i)  
-            `EXE_DIV_OP: begin            // div ָ 
+            `EXE_DIV_OP: begin            //是 div 指令 
                 if(div_ready_i == `DivResultNotReady) begin 
-                    div_opdata1_o    <= reg1_i;        //  
-                    div_opdata2_o    <= reg2_i;        //  
-                    div_start_o      <= `DivStart;     // ʼ 
-                    signed_div_o     <= 1'b1;          // зų 
-                    stallreq_for_div <= `Stop;         // ˮͣ 
+                    div_opdata1_o    <= reg1_i;        // 被除数 
+                    div_opdata2_o    <= reg2_i;        // 除数 
+                    div_start_o      <= `DivStart;     // 开始除法运算 
+                    signed_div_o     <= 1'b1;          // 有符号除法 
+                    stallreq_for_div <= `Stop;         // 请求流水线暂停 
                 end 
                 else if(div_ready_i == `DivResultReady) begin 
                     div_opdata1_o    <= reg1_i; 
                     div_opdata2_o    <= reg2_i; 
-                    div_start_o      <= `DivStop;        //  
+                    div_start_o      <= `DivStop;        // 结束除法运算 
                     signed_div_o     <= 1'b1; 
-                    stallreq_for_div <= `NoStop;         // ˮͣ 
+                    stallreq_for_div <= `NoStop;         // 不再请求流水线暂停 
                 end 
                 else begin 
                     div_opdata1_o    <= `ZeroWord; 
@@ -375,12 +375,12 @@ always @ (*) begin
                     stallreq_for_div <= `NoStop; 
                 end      
             end 
-            `EXE_DIVU_OP: begin             // divu ָ 
+            `EXE_DIVU_OP: begin             //是 divu 指令 
                 if(div_ready_i == `DivResultNotReady) begin 
                     div_opdata1_o    <= reg1_i; 
                     div_opdata2_o    <= reg2_i; 
                     div_start_o      <= `DivStart; 
-                    signed_div_o     <= 1'b0;             // ޷ų 
+                    signed_div_o     <= 1'b0;             // 无符号除法 
                     stallreq_for_div <= `Stop; 
                 end 
                 else if(div_ready_i == `DivResultReady) begin 
@@ -405,10 +405,10 @@ always @ (*) begin
 end 
     
 /**************************************************************** 
-***********             ۼӡۼ             ********* 
+***********             乘累加、乘累减             ********* 
 *****************************************************************/ 
 
-      // MADDMADDUMSUBMSUBU ָ 
+      // MADD、MADDU、MSUB、MSUBU 指令 
     always @ (*) begin 
         if(rst == `RstEnable) begin 
             hilo_temp_o            <= {`ZeroWord,`ZeroWord}; 
@@ -417,27 +417,27 @@ end
         end 
         else begin 
             case (aluop_i)  
-                `EXE_MADD_OP, `EXE_MADDU_OP: begin     // maddmaddu ָ 
-                    if(cnt_i == 2'b00) begin            // ִн׶εһʱ 
+                `EXE_MADD_OP, `EXE_MADDU_OP: begin     // madd、maddu 指令 
+                    if(cnt_i == 2'b00) begin            // 执行阶段第一个时钟周期 
                         hilo_temp_o            <= mulres; 
                         cnt_o                  <= 2'b01; 
                         hilo_temp1             <= {`ZeroWord,`ZeroWord}; 
                         stallreq_for_madd_msub <= `Stop; 
                     end 
-                    else if(cnt_i == 2'b01) begin      // ִн׶εڶʱ 
+                    else if(cnt_i == 2'b01) begin      // 执行阶段第二个时钟周期 
                         hilo_temp_o            <= {`ZeroWord,`ZeroWord};      
                         cnt_o                  <= 2'b10; 
                         hilo_temp1             <= hilo_temp_i + {HI,LO}; 
                         stallreq_for_madd_msub <= `NoStop; 
                     end 
                 end 
-                `EXE_MSUB_OP, `EXE_MSUBU_OP: begin   // msubmsubu ָ 
-                    if(cnt_i == 2'b00) begin           // ִн׶εһʱ 
+                `EXE_MSUB_OP, `EXE_MSUBU_OP: begin   // msub、msubu 指令 
+                    if(cnt_i == 2'b00) begin           // 执行阶段第一个时钟周期 
                         hilo_temp_o            <=  ~mulres + 1 ; 
                         cnt_o                  <= 2'b01; 
                         stallreq_for_madd_msub <= `Stop; 
                     end 
-                    else if(cnt_i == 2'b01) begin      // ִн׶εڶʱ 
+                    else if(cnt_i == 2'b01) begin      // 执行阶段第二个时钟周期 
                         hilo_temp_o            <= {`ZeroWord,`ZeroWord};           
                         cnt_o                  <= 2'b10; 
                         hilo_temp1             <= hilo_temp_i + {HI,LO}; 
@@ -454,7 +454,7 @@ end
     end
     
 /**************************************************************** 
-***********              ͣˮ              ********* 
+***********              暂停流水线              ********* 
 *****************************************************************/ 
  
     always @ (*) begin 
@@ -462,26 +462,26 @@ end
     end 
     
 /****************************************************************** 
-**  һΣaluop_iָʾͽ ** 
+**  第一段：依据aluop_i指示的运算子类型进行运算 ** 
 *******************************************************************/ 
  
- // ߼
+ // 进行逻辑运算
 always @ (*) begin 
     if(rst == `RstEnable) begin 
         logicout <= `ZeroWord; 
     end 
     else begin 
         case (aluop_i) 
-            `EXE_OR_OP:   begin       // ߼ 
+            `EXE_OR_OP:   begin       // 逻辑或运算 
                 logicout <= reg1_i | reg2_i; 
             end 
-            `EXE_AND_OP:  begin       // ߼ 
+            `EXE_AND_OP:  begin       // 逻辑与运算 
                 logicout <= reg1_i & reg2_i; 
             end 
-            `EXE_NOR_OP:  begin       // ߼ 
+            `EXE_NOR_OP:  begin       // 逻辑或非运算 
                 logicout <= ~(reg1_i |reg2_i); 
             end 
-            `EXE_XOR_OP:  begin       // ߼ 
+            `EXE_XOR_OP:  begin       // 逻辑异或运算 
                 logicout <= reg1_i ^ reg2_i; 
             end 
             default:  begin 
@@ -491,20 +491,20 @@ always @ (*) begin
     end    //if 
 end        //always 
 
-// λ
+// 进行移位运算
 always @ (*) begin 
     if(rst == `RstEnable) begin 
         shiftres <= `ZeroWord; 
     end 
     else begin 
         case (aluop_i) 
-            `EXE_SLL_OP:  begin       // ߼ 
+            `EXE_SLL_OP:  begin       // 逻辑左移 
                 shiftres <= reg2_i << reg1_i[4 : 0] ; 
             end 
-            `EXE_SRL_OP:  begin       // ߼ 
+            `EXE_SRL_OP:  begin       // 逻辑右移 
                 shiftres <= reg2_i >> reg1_i[4 : 0]; 
             end 
-            `EXE_SRA_OP:  begin       //  
+            `EXE_SRA_OP:  begin       // 算术右移 
                 shiftres <= ({32{reg2_i[31]}} << (6'd32 - {1'b0, reg1_i[4 : 0]})) | reg2_i >> reg1_i[4 : 0]; 
             end 
             default:  begin 
@@ -515,12 +515,12 @@ always @ (*) begin
 end      //always 
  
 /**************************************************************** 
-**  ڶΣalusel_iָʾͣѡһΪս ** 
-**  жǷ쳣
+**  第二段：依据alusel_i指示的运算类型，选择一个运算结果作为最终结果 ** 
+**  判断是否发生溢出异常
 *****************************************************************/ 
  
-//  alusel_i ѡյ 
-// ָԼ ov_sum ֵжǷ쳣Ӷ ovassert ֵ 
+// 依据 alusel_i 选择最终的运算结果 
+// 依据指令类型以及 ov_sum 的值，判断是否发生溢出异常，从而给出变量 ovassert 的值 
 
 always @ (*) begin 
     wd_o   <= wd_i;            
@@ -535,18 +535,18 @@ always @ (*) begin
 	end 
     case ( alusel_i )  
         `EXE_RES_LOGIC: begin 
-            wdata_o <= logicout;        // ѡ߼Ϊ 
+            wdata_o <= logicout;        // 选择逻辑运算结果为最终运算结果 
         end 
         `EXE_RES_SHIFT: begin 
-            wdata_o <= shiftres;        // ѡλΪ 
+            wdata_o <= shiftres;        // 选择移位运算结果为最终运算结果 
         end
-        `EXE_RES_MOVE: begin            // ƶָ alusel_i Ϊ EXE_RES_MOVE 
+        `EXE_RES_MOVE: begin            // 移动操作指令的 alusel_i 为 EXE_RES_MOVE 
             wdata_o <= moveres;   
         end
-        `EXE_RES_ARITHMETIC: begin      // ˷ļָ 
+        `EXE_RES_ARITHMETIC: begin      // 除乘法外的简单算术操作指令 
             wdata_o <= arithmeticres; 
         end 
-        `EXE_RES_MUL: begin             // ˷ָ mul 
+        `EXE_RES_MUL: begin             // 乘法指令 mul 
             wdata_o <= mulres[31:0]; 
         end
         `EXE_RES_JUMP_BRANCH: begin 
@@ -559,7 +559,7 @@ always @ (*) begin
 end
 
 /**************************************************************** 
-**    һΣõµHILOĴֵ˴Ҫ    ** 
+**    第一段：得到最新的HI、LO寄存器的值，此处要解决数据相关问题    ** 
 *****************************************************************/ 
  
 always @ (*) begin 
@@ -567,10 +567,10 @@ always @ (*) begin
         {HI,LO} <= {`ZeroWord,`ZeroWord}; 
     end 
     else if(mem_whilo_i == `WriteEnable) begin 
-        {HI,LO} <= {mem_hi_i,mem_lo_i};   // ô׶εָҪд HILO Ĵ 
+        {HI,LO} <= {mem_hi_i,mem_lo_i};   // 访存阶段的指令要写 HI、LO 寄存器 
     end 
     else if(wb_whilo_i == `WriteEnable) begin 
-        {HI,LO} <= {wb_hi_i,wb_lo_i};     // д׶εָҪд HILO Ĵ 
+        {HI,LO} <= {wb_hi_i,wb_lo_i};     // 回写阶段的指令要写 HI、LO 寄存器 
     end 
     else begin 
         {HI,LO} <= {hi_i,lo_i}; 
@@ -578,7 +578,7 @@ always @ (*) begin
 end
 
 /**************************************************************** 
-************    ڶΣMFHIMFLOMOVNMOVZָ    ************* 
+************    第二段：MFHI、MFLO、MOVN、MOVZ指令    ************* 
 *****************************************************************/ 
  
 always @ (*) begin 
@@ -589,34 +589,34 @@ always @ (*) begin
         moveres <= `ZeroWord; 
         case (aluop_i) 
             `EXE_MFHI_OP: begin 
-            //  mfhi ָô HI ֵΪƶĽ 
+            // 如果是 mfhi 指令，那么将 HI 的值作为移动操作的结果 
                 moveres <= HI;  
             end 
             `EXE_MFLO_OP: begin 
-            //  mflo ָô LO ֵΪƶĽ 
+            // 如果是 mflo 指令，那么将 LO 的值作为移动操作的结果 
                 moveres <= LO; 
             end 
             `EXE_MOVZ_OP: begin 
-            //  movz ָô reg1_i ֵΪƶĽ 
+            // 如果是 movz 指令，那么将 reg1_i 的值作为移动操作的结果 
                 moveres <= reg1_i; 
             end 
             `EXE_MOVN_OP: begin 
-            //  movn ָô reg1_i ֵΪƶĽ 
+            // 如果是 movn 指令，那么将 reg1_i 的值作为移动操作的结果 
                 moveres <= reg1_i; 
             end 
-            `EXE_MFC0_OP: begin 
-                // Ҫ CP0 жȡļĴĵַ 
+            `EXE_MFC0_OP, `EXE_DI_OP, `EXE_EI_OP: begin 
+                // 要从 CP0 中读取的寄存器的地址，di、ei 的 rd 字段固定为 12，即 Status 寄存器 
                 cp0_reg_read_addr_o <= inst_i[15:11];  
                 
-                // ȡ CP0 ָĴֵ 
+                // 读取到的 CP0 中指定寄存器的值 
                 moveres <= cp0_reg_data_i;             
                 
-                // жǷ 
+                // 判断是否存在数据相关 
                 if( mem_cp0_reg_we == `WriteEnable && mem_cp0_reg_write_addr == inst_i[15:11] ) begin 
-                    moveres <= mem_cp0_reg_data;      // ô׶δ 
+                    moveres <= mem_cp0_reg_data;      // 与访存阶段存在数据相关 
                 end 
                 else if( wb_cp0_reg_we == `WriteEnable && wb_cp0_reg_write_addr == inst_i[15:11] ) begin 
-                    moveres <= wb_cp0_reg_data;       // д׶δ 
+                    moveres <= wb_cp0_reg_data;       // 与回写阶段存在数据相关 
                 end 
             end
             default: begin 
@@ -626,10 +626,10 @@ always @ (*) begin
 end
 
 /**************************************************************** 
-*  ĶΣMTHIMTLOָôҪwhilo_ohi_olo_iֵ * 
+*  第四段：如果是MTHI、MTLO指令，那么需要给出whilo_o、hi_o、lo_i的值 * 
 *****************************************************************/ 
 
-// ȷ HILO ĴĲϢ
+// 确定对 HI、LO 寄存器的操作信息
  
 always @ (*) begin 
     if(rst == `RstEnable) begin 
@@ -652,7 +652,7 @@ always @ (*) begin
         hi_o    <= div_result_i[63:32]; 
         lo_o    <= div_result_i[31:0];
     end
-    else if((aluop_i == `EXE_MULT_OP) || (aluop_i == `EXE_MULTU_OP)) begin  // multmultu ָ 
+    else if((aluop_i == `EXE_MULT_OP) || (aluop_i == `EXE_MULTU_OP)) begin  // mult、multu 指令 
         whilo_o <= `WriteEnable; 
         hi_o    <= mulres[63:32];
         lo_o    <= mulres[31:0]; 
@@ -660,11 +660,11 @@ always @ (*) begin
     else if(aluop_i == `EXE_MTHI_OP) begin 
         whilo_o <= `WriteEnable; 
         hi_o    <= reg1_i; 
-        lo_o    <= LO;             // д HI Ĵ LO ֲ 
+        lo_o    <= LO;             // 写 HI 寄存器，所以 LO 保持不变 
     end 
     else if(aluop_i == `EXE_MTLO_OP) begin 
         whilo_o <= `WriteEnable; 
-        hi_o    <= HI;             // д LO Ĵ HI ֲ 
+        hi_o    <= HI;             // 写 LO 寄存器，所以 HI 保持不变 
         lo_o    <= reg1_i;  
     end 
     else begin 
@@ -675,7 +675,7 @@ always @ (*) begin
 end
 
 /**************************************************************** 
-***********          mtc0 ִָн        ********* 
+***********      给出 mtc0、di、ei 指令的执行结果      ********* 
 *****************************************************************/
  
 always @ (*) begin 
@@ -684,11 +684,21 @@ always @ (*) begin
         cp0_reg_we_o         <= `WriteDisable; 
         cp0_reg_data_o       <= `ZeroWord; 
     end 
-    else if(aluop_i == `EXE_MTC0_OP) begin  //  mtc0 ָ 
+    else if(aluop_i == `EXE_MTC0_OP) begin  // 是 mtc0 指令 
         cp0_reg_write_addr_o <= inst_i[15:11]; 
         cp0_reg_we_o         <= `WriteEnable; 
         cp0_reg_data_o       <= reg1_i; 
     end 
+    else if(aluop_i == `EXE_DI_OP) begin    // 是 di 指令，moveres 为 Status 的最新值，清除 IE 位后写回 
+        cp0_reg_write_addr_o <= `CP0_REG_STATUS; 
+        cp0_reg_we_o         <= `WriteEnable; 
+        cp0_reg_data_o       <= {moveres[31:1], 1'b0}; 
+    end 
+    else if(aluop_i == `EXE_EI_OP) begin    // 是 ei 指令，设置 IE 位后写回 
+        cp0_reg_write_addr_o <= `CP0_REG_STATUS; 
+        cp0_reg_we_o         <= `WriteEnable; 
+        cp0_reg_data_o       <= {moveres[31:1], 1'b1}; 
+    end 
     else begin 
         cp0_reg_write_addr_o <= 5'b00000; 
         cp0_reg_we_o         <= `WriteDisable; 
@@ -697,39 +707,39 @@ always @ (*) begin
 end
 
 /**************************************************************** 
-***********           жǷ쳣        ********** 
+***********           判断是否发生自陷异常        ********** 
 *****************************************************************/
 
-// õıȽϽжǷָӶ trapassert ֵ 
+// 依据上面得到的比较结果，判断是否满足自陷指令的条件，从而给出变量 trapassert 的值 
 always @ (*) begin 
     if(rst == `RstEnable) begin 
         trapassert <= `TrapNotAssert; 
     end 
     else begin
-        trapassert <= `TrapNotAssert;    //Ĭû쳣 
+        trapassert <= `TrapNotAssert;    //默认没有自陷异常 
         case (aluop_i) 
-            // teqteqi ָ 
+            // teq、teqi 指令 
             `EXE_TEQ_OP, `EXE_TEQI_OP: begin 
                 if( reg1_i == reg2_i ) begin 
                     trapassert <= `TrapAssert; 
                 end 
             end 
  
-            // tgetgeitgeiutgeu ָ 
+            // tge、tgei、tgeiu、tgeu 指令 
             `EXE_TGE_OP, `EXE_TGEI_OP, `EXE_TGEIU_OP, `EXE_TGEU_OP: begin 
                 if( ~reg1_lt_reg2 ) begin 
                     trapassert <= `TrapAssert; 
                 end 
             end 
            
-            // tlttltitltiutltu ָ 
+            // tlt、tlti、tltiu、tltu 指令 
             `EXE_TLT_OP, `EXE_TLTI_OP, `EXE_TLTIU_OP, `EXE_TLTU_OP: begin 
                 if( reg1_lt_reg2 ) begin 
                     trapassert <= `TrapAssert; 
                 end 
             end 
  
-            // tnetnei ָ 
+            // tne、tnei 指令 
             `EXE_TNE_OP, `EXE_TNEI_OP: begin 
                 if( reg1_i != reg2_i ) begin 
                     trapassert <= `TrapAssert; 
@@ -6,7 +6,7 @@ module ex_mem(
         
         input wire      flush,
         
-        // ִн׶εϢ 
+        // 来自执行阶段的信息 
         input wire[`RegAddrBus]       ex_wd, 
         input wire                    ex_wreg, 
         input wire[`RegBus]           ex_wdata,   
@@ -14,7 +14,7 @@ module ex_mem(
         input wire[`RegBus]           ex_lo, 
         input wire                    ex_whilo,
         
-        // ԿģϢ
+        // 来自控制模块的信息
         input wire[5:0]               stall,
         
         input wire[`DoubleRegBus]     hilo_i, 
@@ -33,7 +33,7 @@ module ex_mem(
         input wire                   ex_is_in_delayslot, 
         input wire[`RegBus]          ex_current_inst_address,
         
-        // ͵ô׶εϢ 
+        // 送到访存阶段的信息 
         output reg[`RegAddrBus]       mem_wd, 
         output reg                    mem_wreg, 
         output reg[`RegBus]           mem_wdata,
@@ -58,15 +58,15 @@ module ex_mem(
         output reg[`RegBus]          mem_current_inst_address
 );
 
-       //1 stall[3] Ϊ Stopstall[4] Ϊ NoStop ʱʾִн׶ͣ 
-       //     ô׶μʹÿָΪһڽô׶εָ 
-       //2 stall[3] Ϊ NoStop ʱִн׶μִкָô׶ 
-       //3£ַô׶εļĴ mem_wbmem_wregmwm_wdata 
-       //     mem_himem_lomem_whilo 
+       //（1）当 stall[3] 为 Stop，stall[4] 为 NoStop 时，表示执行阶段暂停， 
+       //     而访存阶段继续，所以使用空指令作为下一个周期进入访存阶段的指令 
+       //（2）当 stall[3] 为 NoStop 时，执行阶段继续，执行后的指令进入访存阶段 
+       //（3）其余情况下，保持访存阶段的寄存器 mem_wb、mem_wreg、mwm_wdata、 
+       //     mem_hi、mem_lo、mem_whilo 不变
        
-       // ˮִн׶ͣʱ򣬽ź hilo_i ͨӿ hilo_o ͳ 
-       // ź cnt_i ͨӿ cnt_o ͳʱ̣hilo_o Ϊ 0cnt_o 
-       // ҲΪ 0
+       // 在流水线执行阶段暂停的时候，将输入信号 hilo_i 通过输出接口 hilo_o 送出， 
+       // 输入信号 cnt_i 通过输出接口 cnt_o 送出。其余时刻，hilo_o 为 0，cnt_o 
+       // 也为 0
 
 always @ (posedge clk) begin 
     if(rst == `RstEnable) begin 
@@ -88,7 +88,7 @@ always @ (posedge clk) begin
         mem_is_in_delayslot      <= `NotInDelaySlot; 
         mem_current_inst_address <= `ZeroWord;
     end 
-    else if(flush == 1'b1) begin // ˮ 
+    else if(flush == 1'b1) begin // 清除流水线 
         mem_wd    <= `NOPRegAddr; 
         mem_wreg  <= `WriteDisable; 
         mem_wdata <= `ZeroWord; 
@@ -138,7 +138,7 @@ always @ (posedge clk) begin
         mem_aluop    <= ex_aluop; 
         mem_mem_addr <= ex_mem_addr; 
         mem_reg2     <= ex_reg2;
-        // ִн׶ûͣʱ򣬽 CP0 мĴдϢݵô׶ 
+        // 在执行阶段没有暂停的时候，将对 CP0 中寄存器的写信息传递到访存阶段 
         mem_cp0_reg_we           <= ex_cp0_reg_we; 
         mem_cp0_reg_write_addr   <= ex_cp0_reg_write_addr; 
         mem_cp0_reg_data         <= ex_cp0_reg_data;
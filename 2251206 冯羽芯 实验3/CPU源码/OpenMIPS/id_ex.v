@@ -4,7 +4,7 @@ module id_ex(
     input wire                    clk, 
     input wire                    rst, 
     
-    // ׶δݹϢ 
+    // 从译码阶段传递过来的信息 
     input wire[`AluOpBus]         id_aluop, 
     input wire[`AluSelBus]        id_alusel, 
     input wire[`RegBus]           id_reg1, 
@@ -12,31 +12,31 @@ module id_ex(
     input wire[`RegAddrBus]       id_wd, 
     input wire                    id_wreg,  
     
-    input wire[5:0]               stall,      // ԿģϢ
+    input wire[5:0]               stall,      // 来自控制模块的信息
     
-    input wire[`RegBus]           id_link_address,            // ׶εתָҪķصַ
-    input wire                    id_is_in_delayslot,         // ǰ׶εָǷλӳٲ 
-    input wire                    next_inst_in_delayslot_i,   // һ׶εָǷλӳٲ
+    input wire[`RegBus]           id_link_address,            // 处于译码阶段的转移指令要保存的返回地址
+    input wire                    id_is_in_delayslot,         // 当前处于译码阶段的指令是否位于延迟槽 
+    input wire                    next_inst_in_delayslot_i,   // 下一条进入译码阶段的指令是否位于延迟槽
     
-    input wire[`RegBus]           id_inst,    //  EX ׶μ load/store ַ
+    input wire[`RegBus]           id_inst,    // 方便 EX 阶段计算 load/store 地址
     
     input wire                    flush, 
     
     input wire[`RegBus]           id_current_inst_address, 
     input wire[31:0]              id_excepttype,
     
-    // ݵִн׶εϢ 
-    output reg[`AluOpBus]         ex_aluop,   // 
-    output reg[`AluSelBus]        ex_alusel,  // 
+    // 传递到执行阶段的信息 
+    output reg[`AluOpBus]         ex_aluop,   // 运算的子类型
+    output reg[`AluSelBus]        ex_alusel,  // 运算的类型
     output reg[`RegBus]           ex_reg1, 
     output reg[`RegBus]           ex_reg2, 
-    output reg[`RegAddrBus]       ex_wd,      // ҪдĿļĴַ
-    output reg                    ex_wreg,    // ǷҪдĿļĴ
+    output reg[`RegAddrBus]       ex_wd,      // 要写入的目的寄存器地址
+    output reg                    ex_wreg,    // 是否有要写入的目的寄存器
     
-    output reg[`RegBus]           ex_link_address,            // ִн׶εתָҪķصַ
-    output reg                    ex_is_in_delayslot,         // ǰִн׶εָǷλӳٲ
-    output reg                    is_in_delayslot_o,          // ǰ׶εָǷλӳٲ
-    output reg[`RegBus]           ex_inst,                    //  EX ׶μ load/store ַ
+    output reg[`RegBus]           ex_link_address,            // 处于执行阶段的转移指令要保存的返回地址
+    output reg                    ex_is_in_delayslot,         // 当前处于执行阶段的指令是否位于延迟槽
+    output reg                    is_in_delayslot_o,          // 当前进入译码阶段的指令是否位于延迟槽
+    output reg[`RegBus]           ex_inst,                    // 方便 EX 阶段计算 load/store 地址
 
     output reg[`RegBus]           ex_current_inst_address, 
     output reg[31:0]              ex_excepttype
@@ -58,7 +58,7 @@ always @ (posedge clk) begin
         ex_excepttype           <= `ZeroWord; 
         ex_current_inst_address <= `ZeroWord;
     end 
-    else if (flush == 1'b1) begin                 // ˮ
+    else if (flush == 1'b1) begin                 // 清除流水线
         ex_aluop        <= `EXE_NOP_OP; 
         ex_alusel       <= `EXE_RES_NOP; 
         ex_reg1         <= `ZeroWord; 
@@ -95,7 +95,7 @@ always @ (posedge clk) begin
         ex_link_address    <= id_link_address; 
         ex_is_in_delayslot <= id_is_in_delayslot; 
         is_in_delayslot_o  <= next_inst_in_delayslot_i;
-        // ׶ûͣ£ֱӽ ID ģͨӿ ex_inst 
+        // 在译码阶段没有暂停的情况下，直接将 ID 模块的输入通过接口 ex_inst 输出
         ex_inst   <= id_inst;
         
         ex_excepttype           <= id_excepttype; 
@@ -1,7 +1,7 @@
 module mem(
     input wire              rst, 
     
-    // ִн׶εϢ  
+    // 来自执行阶段的信息  
     input wire[`RegAddrBus] wd_i, 
     input wire              wreg_i, 
     input wire[`RegBus]     wdata_i, 
@@ -9,38 +9,38 @@ module mem(
     input wire[`RegBus]     lo_i, 
     input wire              whilo_i,
     
-    input wire[`AluOpBus]   aluop_i,     // ô׶εָҪе
-    input wire[`RegBus]     mem_addr_i,  // ô׶εļء洢ָӦĴ洢ַ
-    input wire[`RegBus]     reg2_i,      // ô׶εĴ洢ָҪ洢ݣ lwllwr ָҪдĿļĴԭʼֵ
+    input wire[`AluOpBus]   aluop_i,     // 访存阶段的指令要进行的运算的子类型
+    input wire[`RegBus]     mem_addr_i,  // 访存阶段的加载、存储指令对应的存储器地址
+    input wire[`RegBus]     reg2_i,      // 访存阶段的存储指令要存储的数据，或者 lwl、lwr 指令要写入的目的寄存器的原始值
     
-    // ⲿݴ洢 RAM Ϣݴ洢ȡ
-    input wire[`RegBus]     mem_data_i,  // 洢 32 λַÿַ 1 ֽ
+    // 来自外部数据存储器 RAM 的信息，从数据存储器读取的数据
+    input wire[`RegBus]     mem_data_i,  // 存储器是 32 位地址，每个地址存 1 字节
     
-    input wire              LLbit_i,           // LLbit ģ LLbit Ĵֵ
-    input wire              wb_LLbit_we_i,     // д׶εָǷҪд LLbit Ĵ 
-    input wire              wb_LLbit_value_i,  // д׶Ҫд LLbit Ĵֵ
+    input wire              LLbit_i,           // LLbit 模块给出的 LLbit 寄存器的值
+    input wire              wb_LLbit_we_i,     // 回写阶段的指令是否要写 LLbit 寄存器 
+    input wire              wb_LLbit_value_i,  // 回写阶段要写入 LLbit 寄存器的值
     
     input wire              cp0_reg_we_i, 
     input wire[4:0]         cp0_reg_write_addr_i, 
     input wire[`RegBus]     cp0_reg_data_i,
     
-    // ִн׶
+    // 来自执行阶段
     input wire[31:0]        excepttype_i, 
     input wire              is_in_delayslot_i, 
     input wire[`RegBus]     current_inst_address_i,
     
-    //  CP0 ģ
+    // 来自 CP0 模块
     input wire[`RegBus]     cp0_status_i, 
     input wire[`RegBus]     cp0_cause_i, 
     input wire[`RegBus]     cp0_epc_i,
     
-    // Իд׶Σǻд׶εָ CP0 мĴдϢ 
-    //  
+    // 来自回写阶段，是回写阶段的指令对 CP0 中寄存器的写信息， 
+    // 用来检测数据相关 
     input wire              wb_cp0_reg_we, 
     input wire[4:0]         wb_cp0_reg_write_addr, 
     input wire[`RegBus]     wb_cp0_reg_data,
     
-    // ô׶εĽ 
+    // 访存阶段的结果 
     output reg[`RegAddrBus] wd_o, 
     output reg              wreg_o, 
     output reg[`RegBus]     wdata_o,
@@ -48,52 +48,53 @@ module mem(
     output reg[`RegBus]     lo_o, 
     output reg              whilo_o,
     
-    // ͵ⲿݴ洢RAMϢ
-    output reg[`RegBus]     mem_addr_o,  // Ҫʵݴ洢ĵַ
-    output wire             mem_we_o,    // ǷдΪ 1 ʾд
-    output reg[3:0]         mem_sel_o,   // ֽѡź
-    output reg[`RegBus]     mem_data_o,  // Ҫдݴ洢
-    output reg              mem_ce_o,    // ݴ洢ʹź
-    output reg              LLbit_we_o,     // ô׶εָǷҪд LLbit Ĵ
-    output reg              LLbit_value_o,  // ô׶εָҪд LLbit Ĵֵ
+    // 送到外部数据存储器RAM的信息
+    output reg[`RegBus]     mem_addr_o,  // 要访问的数据存储器的地址
+    output wire             mem_we_o,    // 是否是写操作，为 1 表示是写操作
+    output reg[3:0]         mem_sel_o,   // 字节选择信号
+    output reg[`RegBus]     mem_data_o,  // 要写入数据存储器的数据
+    output reg              mem_ce_o,    // 数据存储器使能信号
+    output reg              LLbit_we_o,     // 访存阶段的指令是否要写 LLbit 寄存器
+    output reg              LLbit_value_o,  // 访存阶段的指令要写入 LLbit 寄存器的值
+    output reg[`RegBus]     LLbit_addr_o,   // ll 指令访问的地址，交给独占监视器记录
     
     output reg              cp0_reg_we_o, 
     output reg[4:0]         cp0_reg_write_addr_o, 
     output reg[`RegBus]     cp0_reg_data_o,
     
-    output reg[31:0]        excepttype_o,       // յ쳣
-    output wire[`RegBus]    cp0_epc_o,          // CP0  EPC Ĵֵ
-    output wire             is_in_delayslot_o,  // ô׶εָǷӳٲָ
+    output reg[31:0]        excepttype_o,       // 最终的异常类型
+    output wire[`RegBus]    cp0_epc_o,          // CP0 中 EPC 寄存器的最新值
+    output wire             is_in_delayslot_o,  // 访存阶段的指令是否是延迟槽指令
 
-    output wire[`RegBus]    current_inst_address_o // ô׶ָĵַ
+    output wire[`RegBus]    current_inst_address_o // 访存阶段指令的地址
 );
 
-    reg               LLbit;      //  LLbit Ĵֵ
+    reg               LLbit;      // 保存 LLbit 寄存器的最新值
 
-    reg[`RegBus]      cp0_status;   //  CP0  Status Ĵֵ 
-    reg[`RegBus]      cp0_cause;    //  CP0  Cause Ĵֵ 
-    reg[`RegBus]      cp0_epc;      //  CP0  EPC Ĵֵ 
+    reg[`RegBus]      cp0_status;   // 用来保存 CP0 中 Status 寄存器的最新值 
+    reg[`RegBus]      cp0_cause;    // 用来保存 CP0 中 Cause 寄存器的最新值 
+    reg[`RegBus]      cp0_epc;      // 用来保存 CP0 中 EPC 寄存器的最新值 
 
     wire[`RegBus]     zero32; 
     reg               mem_we; 
  
     assign zero32   = `ZeroWord;
     
-    // is_in_delayslot_o ʾô׶εָǷӳٲָ 
+    // is_in_delayslot_o 表示访存阶段的指令是否是延迟槽指令 
     assign is_in_delayslot_o = is_in_delayslot_i;
     
-    // current_inst_address_o Ƿô׶ָĵַ 
+    // current_inst_address_o 是访存阶段指令的地址 
     assign current_inst_address_o = current_inst_address_i;
     
-  // ȡ LLbit Ĵֵд׶εָҪд LLbitôд׶Ҫд 
-  // ֵ LLbit Ĵֵ֮LLbit ģֵ LLbit_i ֵ 
+  // 获取 LLbit 寄存器的最新值，如果回写阶段的指令要写 LLbit，那么回写阶段要写入的 
+  // 值就是 LLbit 寄存器的最新值，反之，LLbit 模块给出的值 LLbit_i 是最新值 
 always @ (*) begin 
     if(rst == `RstEnable) begin 
         LLbit <= 1'b0; 
     end 
     else begin 
         if(wb_LLbit_we_i == 1'b1) begin 
-            LLbit <= wb_LLbit_value_i;     // д׶εָҪд LLbit 
+            LLbit <= wb_LLbit_value_i;     // 回写阶段的指令要写 LLbit 
         end 
         else begin 
             LLbit <= LLbit_i; 
@@ -116,6 +117,7 @@ always @ (*) begin
         mem_ce_o   <= `ChipDisable;
         LLbit_we_o    <= 1'b0; 
         LLbit_value_o <= 1'b0;
+        LLbit_addr_o  <= `ZeroWord;
         cp0_reg_we_o         <= `WriteDisable; 
         cp0_reg_write_addr_o <= 5'b00000; 
         cp0_reg_data_o       <= `ZeroWord;
@@ -129,35 +131,36 @@ always @ (*) begin
         whilo_o <= whilo_i;
         LLbit_we_o    <= 1'b0; 
         LLbit_value_o <= 1'b0;
+        LLbit_addr_o  <= `ZeroWord;
         mem_we     <= `WriteDisable; 
         mem_addr_o <= `ZeroWord; 
         mem_sel_o  <= 4'b1111; 
         mem_ce_o   <= `ChipDisable;
-        //  CP0 мĴдϢݵˮһ 
+        // 将对 CP0 中寄存器的写信息传递到流水线下一级 
         cp0_reg_we_o         <= cp0_reg_we_i; 
         cp0_reg_write_addr_o <= cp0_reg_write_addr_i; 
         cp0_reg_data_o       <= cp0_reg_data_i;
         
         case (aluop_i)
-            `EXE_LB_OP: begin                  // lb ָ 
+            `EXE_LB_OP: begin                  // lb 指令 
                 mem_addr_o <= mem_addr_i; 
                 mem_we     <= `WriteDisable; 
                 mem_ce_o   <= `ChipEnable; 
                 case (mem_addr_i[1:0]) 
                     2'b00: begin 
-                        wdata_o   <= {{24{mem_data_i[31]}}, mem_data_i[31:24]};  // ͵ַ
-                        mem_sel_o <= 4'b1000; // ָ ֵĵһֽ
+                        wdata_o   <= {{24{mem_data_i[31]}}, mem_data_i[31:24]};  // 低地址
+                        mem_sel_o <= 4'b1000; // 指的是 读出这个字的第一个字节
                     end 
                     2'b01: begin 
                         wdata_o   <= {{24{mem_data_i[23]}}, mem_data_i[23:16]}; 
-                        mem_sel_o <= 4'b0100; // ָ ֵĵڶֽ
+                        mem_sel_o <= 4'b0100; // 指的是 读出这个字的第二个字节
                     end 
                     2'b10: begin 
                         wdata_o   <= {{24{mem_data_i[15]}}, mem_data_i[15:8]}; 
                         mem_sel_o <= 4'b0010; 
                     end 
                     2'b11: begin 
-                        wdata_o   <= {{24{mem_data_i[7]}}, mem_data_i[7:0]};    // ߵַ
+                        wdata_o   <= {{24{mem_data_i[7]}}, mem_data_i[7:0]};    // 高地址
                         mem_sel_o <= 4'b0001; 
                     end 
                     default: begin 
@@ -165,7 +168,7 @@ always @ (*) begin
                     end 
                 endcase 
             end
-            `EXE_LBU_OP: begin            // lbu ָ 
+            `EXE_LBU_OP: begin            // lbu 指令 
                 mem_addr_o <= mem_addr_i; 
                 mem_we     <= `WriteDisable; 
                 mem_ce_o   <= `ChipEnable; 
@@ -191,7 +194,7 @@ always @ (*) begin
                     end 
                 endcase 
             end
-            `EXE_LH_OP: begin                  // lh ָ 
+            `EXE_LH_OP: begin                  // lh 指令 
                 mem_addr_o <= mem_addr_i; 
                 mem_we     <= `WriteDisable; 
                 mem_ce_o   <= `ChipEnable; 
@@ -209,7 +212,7 @@ always @ (*) begin
                     end 
                 endcase 
             end
-            `EXE_LHU_OP: begin            // lhu ָ 
+            `EXE_LHU_OP: begin            // lhu 指令 
                 mem_addr_o <= mem_addr_i; 
                 mem_we     <= `WriteDisable; 
                 mem_ce_o   <= `ChipEnable; 
@@ -227,14 +230,14 @@ always @ (*) begin
                     end 
                 endcase 
             end
-            `EXE_LW_OP: begin                   // lw ָ 
+            `EXE_LW_OP: begin                   // lw 指令 
                 mem_addr_o <= mem_addr_i; 
                 mem_we     <= `WriteDisable; 
                 wdata_o    <= mem_data_i; 
                 mem_sel_o  <= 4'b1111; 
                 mem_ce_o   <= `ChipEnable; 
             end 
-            `EXE_LWL_OP: begin            // lwl ָ 
+            `EXE_LWL_OP: begin            // lwl 指令 
                 mem_addr_o <= {mem_addr_i[31:2], 2'b00}; 
                 mem_we     <= `WriteDisable; 
                 mem_sel_o  <= 4'b1111; 
@@ -257,7 +260,7 @@ always @ (*) begin
                     end 
                 endcase 
             end
-            `EXE_LWR_OP: begin             // lwr ָ 
+            `EXE_LWR_OP: begin             // lwr 指令 
                 mem_addr_o <= {mem_addr_i[31:2], 2'b00}; 
                 mem_we     <= `WriteDisable; 
                 mem_sel_o  <= 4'b1111; 
@@ -280,21 +283,22 @@ always @ (*) begin
                     end 
                 endcase 
             end
-            `EXE_LL_OP: begin               // ll ָķô 
+            `EXE_LL_OP: begin               // ll 指令的访存输出 
                 mem_addr_o    <= mem_addr_i; 
                 mem_we        <= `WriteDisable; 
                 wdata_o       <= mem_data_i; 
                 LLbit_we_o    <= 1'b1; 
                 LLbit_value_o <= 1'b1; 
+                LLbit_addr_o  <= mem_addr_i;  // 记录链接地址
                 mem_sel_o     <= 4'b1111; 
                 mem_ce_o      <= `ChipEnable; 
             end
-            `EXE_SB_OP: begin             // sb ָ 
+            `EXE_SB_OP: begin             // sb 指令 
                 mem_addr_o <= mem_addr_i; 
                 mem_we     <= `WriteEnable; 
                 mem_data_o <= {reg2_i[7:0], reg2_i[7:0], reg2_i[7:0], reg2_i[7:0]}; 
                 mem_ce_o   <= `ChipEnable; 
-                case (mem_addr_i[1:0]) // ʵϵַֻи 30 λЧΪ Wishbone 
+                case (mem_addr_i[1:0]) // 实际上地址只有高 30 位有效，为配合 Wishbone 总线
                     2'b00: begin 
                         mem_sel_o <= 4'b1000; 
                     end 
@@ -312,7 +316,7 @@ always @ (*) begin
                     end 
                 endcase 
             end
-            `EXE_SH_OP: begin             // sh ָ 
+            `EXE_SH_OP: begin             // sh 指令 
                 mem_addr_o <= mem_addr_i; 
                 mem_we     <= `WriteEnable; 
                 mem_data_o <= {reg2_i[15:0],reg2_i[15:0]}; 
@@ -329,14 +333,14 @@ always @ (*) begin
                     end 
                 endcase 
             end
-            `EXE_SW_OP: begin             // sw ָ 
+            `EXE_SW_OP: begin             // sw 指令 
                 mem_addr_o <= mem_addr_i; 
                 mem_we     <= `WriteEnable; 
                 mem_data_o <= reg2_i; 
                 mem_sel_o  <= 4'b1111; 
                 mem_ce_o   <= `ChipEnable; 
             end
-            `EXE_SWL_OP: begin             // swl ָ 
+            `EXE_SWL_OP: begin             // swl 指令 
                 mem_addr_o <= {mem_addr_i[31:2], 2'b00}; 
                 mem_we     <= `WriteEnable; 
                 mem_ce_o   <= `ChipEnable; 
@@ -362,7 +366,7 @@ always @ (*) begin
                     end 
                 endcase 
             end
-            `EXE_SWR_OP:  begin             // swr ָ 
+            `EXE_SWR_OP:  begin             // swr 指令 
                 mem_addr_o <= {mem_addr_i[31:2], 2'b00}; 
                 mem_we     <= `WriteEnable;
                 mem_ce_o   <= `ChipEnable; 
@@ -388,7 +392,7 @@ always @ (*) begin
                     end 
                 endcase 
             end
-            `EXE_SC_OP: begin              // sc ָķô 
+            `EXE_SC_OP: begin              // sc 指令的访存输出 
                 if(LLbit == 1'b1) begin 
                     LLbit_we_o    <= 1'b1; 
                     LLbit_value_o <= 1'b0; 
@@ -411,13 +415,13 @@ always @ (*) begin
 end    
 
 /**************************************************************** 
-***********         һΣõCP0мĴֵ        ********* 
+***********         第一段：得到CP0中寄存器的最新值        ********* 
 *****************************************************************/
 
-   // õ CP0  Status Ĵֵ£ 
-   // жϵǰڻд׶εָǷҪд CP0  Status ĴҪдôҪд 
-   // ֵ Status Ĵֵ֮ CP0 ģͨ cp0_status_i ӿ 
-   // ݾ Status Ĵֵ
+   // 得到 CP0 中 Status 寄存器的最新值，步骤如下： 
+   // 判断当前处于回写阶段的指令是否要写 CP0 中 Status 寄存器，如果要写，那么要写 
+   // 入的值就是 Status 寄存器的最新值，反之，从 CP0 模块通过 cp0_status_i 接口 
+   // 传入的数据就是 Status 寄存器的最新值
    
 always @ (*) begin 
     if(rst == `RstEnable) begin
@@ -431,10 +435,10 @@ always @ (*) begin
     end 
 end
 
-   // õ CP0  EPC Ĵֵ£ 
-   // жϵǰڻд׶εָǷҪд CP0  EPC ĴҪдôҪд 
-   // ֵ EPC Ĵֵ֮ CP0 ģͨ cp0_epc_i ӿڴ 
-   // ݾ EPC Ĵֵ 
+   // 得到 CP0 中 EPC 寄存器的最新值，步骤如下： 
+   // 判断当前处于回写阶段的指令是否要写 CP0 中 EPC 寄存器，如果要写，那么要写入 
+   // 的值就是 EPC 寄存器的最新值，反之，从 CP0 模块通过 cp0_epc_i 接口传入的数 
+   // 据就是 EPC 寄存器的最新值 
 always @ (*) begin 
     if(rst == `RstEnable) begin 
         cp0_epc <= `ZeroWord; 
@@ -447,22 +451,22 @@ always @ (*) begin
     end 
 end
 
-    //  EPC Ĵֵͨӿ cp0_epc_o  
+    // 将 EPC 寄存器的最新值通过接口 cp0_epc_o 输出 
     assign cp0_epc_o = cp0_epc;
    
-   // õ CP0  Cause Ĵֵ£ 
-   // жϵǰڻд׶εָǷҪд CP0  Cause ĴҪдôҪд 
-   // ֵ Cause Ĵֵעһ㣺Cause Ĵֻмֶǿд 
-   // ġ֮ CP0 ģͨ cp0_cause_i ӿڴݾ Cause Ĵ 
-   // ֵ 
+   // 得到 CP0 中 Cause 寄存器的最新值，步骤如下： 
+   // 判断当前处于回写阶段的指令是否要写 CP0 中 Cause 寄存器，如果要写，那么要写入 
+   // 的值就是 Cause 寄存器的最新值，不过注意一点：Cause 寄存器只有几个字段是可写 
+   // 的。反之，从 CP0 模块通过 cp0_cause_i 接口传入的数据就是 Cause 寄存器的最新 
+   // 值 
 always @ (*) begin 
     if(rst == `RstEnable) begin 
         cp0_cause <= `ZeroWord; 
     end 
     else if((wb_cp0_reg_we == `WriteEnable) && (wb_cp0_reg_write_addr == `CP0_REG_CAUSE )) begin 
-        cp0_cause[9:8] <= wb_cp0_reg_data[9:8];  // IP[1:0] ֶǿд 
-        cp0_cause[22]  <= wb_cp0_reg_data[22];   // WP ֶǿд 
-        cp0_cause[23]  <= wb_cp0_reg_data[23];   // IV ֶǿд 
+        cp0_cause[9:8] <= wb_cp0_reg_data[9:8];  // IP[1:0] 字段是可写的 
+        cp0_cause[22]  <= wb_cp0_reg_data[22];   // WP 字段是可写的 
+        cp0_cause[23]  <= wb_cp0_reg_data[23];   // IV 字段是可写的 
     end 
     else begin 
         cp0_cause      <= cp0_cause_i; 
@@ -470,7 +474,7 @@ always @ (*) begin
 end
 
 /**************************************************************** 
-***********           ڶΣյ쳣          ********* 
+***********           第二段：给出最终的异常类型          ********* 
 *****************************************************************/ 
 
 always @ (*) begin 
@@ -506,13 +510,13 @@ always @ (*) begin
 end
 
 /**************************************************************** 
-***********         Σݴ洢д        ********* 
+***********         第三段：给出对数据存储器的写操作        ********* 
 *****************************************************************/ 
  
-   // mem_we_o ݴ洢ʾǷǶݴ洢д 
-   // 쳣ôҪȡݴ洢д 
+   // mem_we_o 输出到数据存储器，表示是否是对数据存储器的写操作， 
+   // 如果发生了异常，那么需要取消对数据存储器的写操作 
    assign mem_we_o = mem_we & (~(|excepttype_o));
    
-   // һߴÿһλ
+   // 一个竖线代表每一位都做或运算
 
 endmodule
@@ -4,7 +4,7 @@ module mem_wb(
     input wire              clk, 
     input wire              rst, 
     
-    // ô׶εĽ 
+    // 访存阶段的结果 
     input wire[`RegAddrBus] mem_wd, 
     input wire              mem_wreg, 
     input wire[`RegBus]     mem_wdata, 
@@ -12,18 +12,19 @@ module mem_wb(
     input wire[`RegBus]     mem_lo, 
     input wire              mem_whilo, 
     
-    input wire[5:0]         stall,       // ԿģϢ
+    input wire[5:0]         stall,       // 来自控制模块的信息
     
-    input wire              flush,       // ˮź
+    input wire              flush,       // 流水线清除信号
     
-    input wire              mem_LLbit_we,     // ô׶εָǷҪд LLbit Ĵ
-    input wire              mem_LLbit_value,  // ô׶εָҪд LLbit Ĵֵ
+    input wire              mem_LLbit_we,     // 访存阶段的指令是否要写 LLbit 寄存器
+    input wire              mem_LLbit_value,  // 访存阶段的指令要写入 LLbit 寄存器的值
+    input wire[`RegBus]     mem_LLbit_addr,   // 访存阶段 ll 指令的链接地址
     
     input wire              mem_cp0_reg_we, 
     input wire[4:0]         mem_cp0_reg_write_addr, 
     input wire[`RegBus]     mem_cp0_reg_data,
     
-    // ͵д׶εϢ 
+    // 送到回写阶段的信息 
     output reg[`RegAddrBus] wb_wd, 
     output reg              wb_wreg, 
     output reg[`RegBus]     wb_wdata,
@@ -31,8 +32,9 @@ module mem_wb(
     output reg[`RegBus]     wb_lo, 
     output reg              wb_whilo,
     
-    output reg              wb_LLbit_we,       // д׶εָǷҪд LLbit Ĵ
-    output reg              wb_LLbit_value,    // д׶εָҪд LLbit Ĵֵ
+    output reg              wb_LLbit_we,       // 回写阶段的指令是否要写 LLbit 寄存器
+    output reg              wb_LLbit_value,    // 回写阶段的指令要写入 LLbit 寄存器的值
+    output reg[`RegBus]     wb_LLbit_addr,     // 回写阶段 ll 指令的链接地址
     
     output reg              wb_cp0_reg_we, 
     output reg[4:0]         wb_cp0_reg_write_addr, 
@@ -49,6 +51,7 @@ always @ (posedge clk) begin
         wb_whilo <= `WriteDisable;
         wb_LLbit_we    <= 1'b0; 
         wb_LLbit_value <= 1'b0;
+        wb_LLbit_addr  <= `ZeroWord;
         wb_cp0_reg_we         <= `WriteDisable; 
         wb_cp0_reg_write_addr <= 5'b00000; 
         wb_cp0_reg_data       <= `ZeroWord;
@@ -62,6 +65,7 @@ always @ (posedge clk) begin
         wb_whilo              <= `WriteDisable; 
         wb_LLbit_we           <= 1'b0; 
         wb_LLbit_value        <= 1'b0;        
+        wb_LLbit_addr         <= `ZeroWord;
         wb_cp0_reg_we         <= `WriteDisable; 
         wb_cp0_reg_write_addr <= 5'b00000; 
         wb_cp0_reg_data       <= `ZeroWord;
@@ -75,6 +79,7 @@ always @ (posedge clk) begin
         wb_whilo <= `WriteDisable;
         wb_LLbit_we    <= 1'b0; 
         wb_LLbit_value <= 1'b0;
+        wb_LLbit_addr  <= `ZeroWord;
         wb_cp0_reg_we         <= `WriteDisable; 
         wb_cp0_reg_write_addr <= 5'b00000; 
         wb_cp0_reg_data       <= `ZeroWord;
@@ -88,7 +93,8 @@ always @ (posedge clk) begin
         wb_whilo <= mem_whilo;
         wb_LLbit_we    <= mem_LLbit_we; 
         wb_LLbit_value <= mem_LLbit_value;
-        // ڷô׶ûͣʱ CP0 мĴдϢݵд׶ 
+        wb_LLbit_addr  <= mem_LLbit_addr;
+        // 在访存阶段没有暂停时，将对 CP0 中寄存器的写信息传递到回写阶段 
         wb_cp0_reg_we         <= mem_cp0_reg_we; 
         wb_cp0_reg_write_addr <= mem_cp0_reg_write_addr; 
         wb_cp0_reg_data       <= mem_cp0_reg_data;
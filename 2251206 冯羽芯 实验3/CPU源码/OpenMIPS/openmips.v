@@ -4,9 +4,9 @@ module openmips(
     input  wire                clk, 
     input  wire                rst, 
     
-    input wire[5:0]            int_i,       // 6 ⲿӲж
+    input wire[5:0]            int_i,       // 6 个外部硬件中断输入
     
-	// ָ wishbone 
+	// 指令 wishbone 总线
 	input wire[`RegBus]           iwishbone_data_i,
 	input wire                    iwishbone_ack_i,
 	output wire[`RegBus]          iwishbone_addr_o,
@@ -16,7 +16,7 @@ module openmips(
 	output wire                   iwishbone_stb_o,
 	output wire                   iwishbone_cyc_o, 
 	
-    //  wishbone 
+    // 数据 wishbone 总线
 	input wire[`RegBus]           dwishbone_data_i,
 	input wire                    dwishbone_ack_i,
 	output wire[`RegBus]          dwishbone_addr_o,
@@ -26,17 +26,24 @@ module openmips(
 	output wire                   dwishbone_stb_o,
 	output wire                   dwishbone_cyc_o,
     
-    output wire                   timer_int_o  // ǷжʱжϷ
+    // 独占监视器的总线监听接口，其它主设备完成写操作时有效
+    input wire                    ll_snoop_we_i,
+    input wire[`RegBus]           ll_snoop_addr_i,
+    
+    // 存储器控制器的写队列已排空，sync 指令据此等待之前的写操作全部完成
+    input wire                    mem_fence_done_i,
+    
+    output wire                   timer_int_o  // 是否有定时中断发生
 );
 
-	wire[`InstBus]     inst_i;	  // ȡصָ
+	wire[`InstBus]     inst_i;	  // 取回的指令
 
-    //  IF/ID ģ׶ ID ģı 
+    // 连接 IF/ID 模块与译码阶段 ID 模块的变量 
     wire[`InstAddrBus] pc; 
     wire[`InstAddrBus] id_pc_i; 
     wire[`InstBus]     id_inst_i; 
     
-    // ׶ ID ģ ID/EX ģı 
+    // 连接译码阶段 ID 模块输出与 ID/EX 模块的输入的变量 
     wire[`AluOpBus]    id_aluop_o; 
     wire[`AluSelBus]   id_alusel_o; 
     wire[`RegBus]      id_reg1_o; 
@@ -51,7 +58,7 @@ module openmips(
     wire[31:0]         id_excepttype_o;
     wire[`RegBus]      id_current_inst_address_o;
     
-    //  ID/EX ģִн׶ EX ģı 
+    // 连接 ID/EX 模块输出与执行阶段 EX 模块的输入的变量 
     wire[`AluOpBus]    ex_aluop_i; 
     wire[`AluSelBus]   ex_alusel_i; 
     wire[`RegBus]      ex_reg1_i; 
@@ -66,7 +73,7 @@ module openmips(
     wire[31:0]         ex_excepttype_i;	
     wire[`RegBus]      ex_current_inst_address_i;
     
-    // ִн׶ EX ģ EX/MEM ģı 
+    // 连接执行阶段 EX 模块的输出与 EX/MEM 模块的输入的变量 
     wire               ex_wreg_o; 
     wire[`RegAddrBus]  ex_wd_o; 
     wire[`RegBus]      ex_wdata_o; 
@@ -75,7 +82,7 @@ module openmips(
 	wire               ex_whilo_o;
 	wire[`AluOpBus]    ex_aluop_o;
 	wire[`RegBus]      ex_mem_addr_o;
-//	wire[`RegBus]      ex_reg1_o; ûhhh
+//	wire[`RegBus]      ex_reg1_o; 没有这个接线hhh
 	wire[`RegBus]      ex_reg2_o;
 	
 	wire               ex_cp0_reg_we_o;
@@ -86,7 +93,7 @@ module openmips(
 	wire[`RegBus]      ex_current_inst_address_o;
 	wire               ex_is_in_delayslot_o;
     
-    //  EX/MEM ģô׶ MEM ģı 
+    // 连接 EX/MEM 模块的输出与访存阶段 MEM 模块的输入的变量 
     wire               mem_wreg_i; 
     wire[`RegAddrBus]  mem_wd_i; 
     wire[`RegBus]      mem_wdata_i; 
@@ -96,7 +103,7 @@ module openmips(
 	
 	wire[`AluOpBus]    mem_aluop_i;
 	wire[`RegBus]      mem_mem_addr_i;
-//	wire[`RegBus]      mem_reg1_i; ûhhh
+//	wire[`RegBus]      mem_reg1_i; 没有这个接线hhh
 	wire[`RegBus]      mem_reg2_i;
 	
 	wire               mem_cp0_reg_we_i;
@@ -107,7 +114,7 @@ module openmips(
 	wire               mem_is_in_delayslot_i;
 	wire[`RegBus]      mem_current_inst_address_i;
     
-    // ӷô׶ MEM ģ MEM/WB ģı 
+    // 连接访存阶段 MEM 模块的输出与 MEM/WB 模块的输入的变量 
     wire               mem_wreg_o; 
     wire[`RegAddrBus]  mem_wd_o; 
     wire[`RegBus]      mem_wdata_o; 
@@ -117,6 +124,7 @@ module openmips(
 	
 	wire               mem_LLbit_value_o;
 	wire               mem_LLbit_we_o;
+	wire[`RegBus]      mem_LLbit_addr_o;
 	
 	wire               mem_cp0_reg_we_o;
 	wire[4:0]          mem_cp0_reg_write_addr_o;
@@ -126,7 +134,7 @@ module openmips(
 	wire               mem_is_in_delayslot_o;
 	wire[`RegBus]      mem_current_inst_address_o;
     
-    //  MEM/WB ģд׶εı        
+    // 连接 MEM/WB 模块的输出与回写阶段的输入的变量        
     wire               wb_wreg_i; 
     wire[`RegAddrBus]  wb_wd_i; 
     wire[`RegBus]      wb_wdata_i; 
@@ -136,6 +144,7 @@ module openmips(
 	
 	wire               wb_LLbit_value_i;
 	wire               wb_LLbit_we_i;	
+	wire[`RegBus]      wb_LLbit_addr_i;
 	
 	wire               wb_cp0_reg_we_i;
 	wire[4:0]          wb_cp0_reg_write_addr_i;
@@ -145,7 +154,7 @@ module openmips(
 	wire               wb_is_in_delayslot_i;
 	wire[`RegBus]      wb_current_inst_address_i;
     
-    // ׶ ID ģͨüĴ Regfile ģı 
+    // 连接译码阶段 ID 模块与通用寄存器 Regfile 模块的变量 
     wire               reg1_read;
     wire               reg2_read; 
     wire[`RegBus]      reg1_data; 
@@ -153,18 +162,18 @@ module openmips(
     wire[`RegAddrBus]  reg1_addr; 
     wire[`RegAddrBus]  reg2_addr; 
     
-	// ִн׶ hilo ģȡ HILO Ĵ
+	// 连接执行阶段与 hilo 模块的输出，读取 HI、LO 寄存器
 	wire[`RegBus] 	hi;
 	wire[`RegBus]   lo;
 	
-	// ִн׶ ex_reg ģ飬ڶڵ MADDMADDUMSUBMSUBU ָ
+	// 连接执行阶段与 ex_reg 模块，用于多周期的 MADD、MADDU、MSUB、MSUBU 指令
 	wire[`DoubleRegBus] hilo_temp_o;
 	wire[1:0] cnt_o;
 	
 	wire[`DoubleRegBus] hilo_temp_i;
 	wire[1:0] cnt_i;
 	
-	// ģ
+	// 除法模块
     wire[`DoubleRegBus] div_result;
 	wire                div_ready;
 	wire[`RegBus]       div_opdata1;
@@ -173,19 +182,24 @@ module openmips(
 	wire                div_annul;
 	wire                signed_div;
 	
-	// ֧ת
+	// 分支与跳转
 	wire is_in_delayslot_i;
 	wire is_in_delayslot_o;
 	wire next_inst_in_delayslot_o;
 	wire id_branch_flag_o;
 	wire[`RegBus] branch_target_address;
 	
-	// ˮͣ
+	// 流水线暂停
     wire[5:0] stall;
 	wire stallreq_from_id;	
 	wire stallreq_from_ex;
     wire stallreq_from_if;
 	wire stallreq_from_mem;
+	wire dwishbone_stallreq;
+	
+	// sync 指令在访存阶段等待写队列排空，保证之前已应答的写操作对其它设备可见
+	assign stallreq_from_mem = dwishbone_stallreq |
+	                           ((mem_aluop_i == `EXE_SYNC_OP) && (mem_fence_done_i == 1'b0));
 	
 	wire LLbit_o;
 	
@@ -213,8 +227,23 @@ module openmips(
 	wire[`RegBus] ram_data_o;
 	wire          ram_ce_o;
     wire[`RegBus] ram_data_i;
+    
+    // 紧耦合存储器 TCM，命中时绕过 wishbone_bus_if
+    wire[`InstBus] itcm_inst_o;
+    wire           itcm_ihit;
+    wire[`RegBus]  itcm_data_o;
+    wire           itcm_hit;
+    wire[`RegBus]  dtcm_data_o;
+    wire           dtcm_hit;
+    wire[`InstBus] iwishbone_inst;
+    wire[`RegBus]  dwishbone_ram_data;
+    
+    // 取指地址落在 ITCM 内时直接取 ITCM 的指令，否则取总线返回的指令
+    assign inst_i     = (itcm_ihit == 1'b1) ? itcm_inst_o : iwishbone_inst;
+    assign ram_data_i = (dtcm_hit == 1'b1)  ? dtcm_data_o :
+                        (itcm_hit == 1'b1)  ? itcm_data_o : dwishbone_ram_data;
    
-    // pc_reg  
+    // pc_reg 例化 
     pc_reg pc_reg0( 
        .clk(clk), 
        .rst(rst), 
@@ -227,19 +256,19 @@ module openmips(
        .ce(rom_ce) 
     ); 
  
-    // IF/ID ģ 
+    // IF/ID 模块例化 
     if_id if_id0( 
         .clk(clk), 
         .rst(rst), 
         .stall(stall),
         .flush(flush),
-        .if_pc(pc),           // һָĵַ
-        .if_inst(inst_i),     // ǰָ
+        .if_pc(pc),           // 下一条指令的地址
+        .if_inst(inst_i),     // 当前指令的内容
         .id_pc(id_pc_i), 
         .id_inst(id_inst_i)        
     ); 
   
-    // ׶ ID ģ 
+    // 译码阶段 ID 模块例化 
     id id0( 
         .rst(rst), 
         .pc_i(id_pc_i), 
@@ -247,29 +276,29 @@ module openmips(
         
         .ex_aluop_i(ex_aluop_o),
                
-        //  Regfile ģ 
+        // 来自 Regfile 模块的输入 
         .reg1_data_i(reg1_data), 
         .reg2_data_i(reg2_data), 
         
-        // ִн׶εָҪдĿļĴϢ
+        // 处于执行阶段的指令要写入的目的寄存器信息
 		.ex_wreg_i(ex_wreg_o),
 		.ex_wdata_i(ex_wdata_o),
 		.ex_wd_i(ex_wd_o),
 
-	    // ڷô׶εָҪдĿļĴϢ
+	    // 处于访存阶段的指令要写入的目的寄存器信息
 		.mem_wreg_i(mem_wreg_o),
 		.mem_wdata_i(mem_wdata_o),
 		.mem_wd_i(mem_wd_o),
 		
 	    .is_in_delayslot_i(is_in_delayslot_i),
         
-        // ͵ regfile ģϢ 
+        // 送到 regfile 模块的信息 
         .reg1_read_o(reg1_read), 
         .reg2_read_o(reg2_read),     
         .reg1_addr_o(reg1_addr), 
         .reg2_addr_o(reg2_addr),  
         
-        // ͵ ID/EX ģϢ 
+        // 送到 ID/EX 模块的信息 
         .aluop_o(id_aluop_o),  
         .alusel_o(id_alusel_o), 
         .reg1_o(id_reg1_o),  
@@ -290,7 +319,7 @@ module openmips(
         .stallreq(stallreq_from_id)		
     ); 
  
-    // ͨüĴ Regfile ģ 
+    // 通用寄存器 Regfile 模块例化 
     regfile regfile1( 
         .clk (clk),    
         .rst (rst), 
@@ -305,7 +334,7 @@ module openmips(
         .rdata2(reg2_data) 
     ); 
  
-    // ID/EX ģ 
+    // ID/EX 模块例化 
     id_ex id_ex0( 
         .clk(clk),          
         .rst(rst), 
@@ -313,7 +342,7 @@ module openmips(
         .stall(stall),
         .flush(flush),
         
-        // ׶ ID ģ鴫ݹϢ 
+        // 从译码阶段 ID 模块传递过来的信息 
         .id_aluop(id_aluop_o), 
         .id_alusel(id_alusel_o), 
         .id_reg1(id_reg1_o),  
@@ -329,7 +358,7 @@ module openmips(
 		.id_excepttype(id_excepttype_o),
 		.id_current_inst_address(id_current_inst_address_o),
         
-        // ݵִн׶ EX ģϢ 
+        // 传递到执行阶段 EX 模块的信息 
         .ex_aluop(ex_aluop_i), 
         .ex_alusel(ex_alusel_i), 
         .ex_reg1(ex_reg1_i),  
@@ -345,11 +374,11 @@ module openmips(
 		.ex_current_inst_address(ex_current_inst_address_i)		
     ); 
   
-    // EX ģ 
+    // EX 模块例化 
     ex ex0( 
         .rst(rst), 
         
-        //  ID/EX ģ鴫ݹĵϢ 
+        // 从 ID/EX 模块传递过来的的信息 
         .aluop_i(ex_aluop_i),  
         .alusel_i(ex_alusel_i), 
         .reg1_i(ex_reg1_i),  
@@ -379,12 +408,12 @@ module openmips(
 		.excepttype_i(ex_excepttype_i),
 		.current_inst_address_i(ex_current_inst_address_i),
 		
-		// ô׶εָǷҪд CP0
+		// 访存阶段的指令是否要写 CP0，用来检测数据相关
   	    .mem_cp0_reg_we(mem_cp0_reg_we_o),
 		.mem_cp0_reg_write_addr(mem_cp0_reg_write_addr_o),
 		.mem_cp0_reg_data(mem_cp0_reg_data_o),
 	
-		// д׶εָǷҪд CP0
+		// 回写阶段的指令是否要写 CP0，用来检测数据相关
       	.wb_cp0_reg_we(wb_cp0_reg_we_i),
 		.wb_cp0_reg_write_addr(wb_cp0_reg_write_addr_i),
 		.wb_cp0_reg_data(wb_cp0_reg_data_i),
@@ -392,12 +421,12 @@ module openmips(
 		.cp0_reg_data_i(cp0_data_o),
 		.cp0_reg_read_addr_o(cp0_raddr_i),
 		
-		// һˮݣд CP0 еļĴ
+		// 向下一流水级传递，用于写 CP0 中的寄存器
 		.cp0_reg_we_o(ex_cp0_reg_we_o),
 		.cp0_reg_write_addr_o(ex_cp0_reg_write_addr_o),
 		.cp0_reg_data_o(ex_cp0_reg_data_o),
         
-        //  EX/MEM ģϢ 
+        // 输出到 EX/MEM 模块的信息 
         .wd_o(ex_wd_o),   
         .wreg_o(ex_wreg_o), 
         .wdata_o(ex_wdata_o),
@@ -424,7 +453,7 @@ module openmips(
 		.stallreq(stallreq_from_ex)
     ); 
  
-    // EX/MEM ģ 
+    // EX/MEM 模块例化 
     ex_mem ex_mem0( 
         .clk(clk),    
         .rst(rst), 
@@ -432,7 +461,7 @@ module openmips(
         .stall(stall),
         .flush(flush),
         
-        // ִн׶ EX ģϢ 
+        // 来自执行阶段 EX 模块的信息 
         .ex_wd(ex_wd_o),   
         .ex_wreg(ex_wreg_o), 
         .ex_wdata(ex_wdata_o), 
@@ -455,7 +484,7 @@ module openmips(
 	    .hilo_i(hilo_temp_o),
 		.cnt_i(cnt_o),	
         
-        // ͵ô׶ MEM ģϢ 
+        // 送到访存阶段 MEM 模块的信息 
         .mem_wd(mem_wd_i),  
         .mem_wreg(mem_wreg_i), 
         .mem_wdata(mem_wdata_i),
@@ -479,11 +508,11 @@ module openmips(
 		.cnt_o(cnt_i)
     ); 
     
-    // MEM ģ 
+    // MEM 模块例化 
     mem mem0( 
         .rst(rst), 
         
-        //  EX/MEM ģϢ  
+        // 来自 EX/MEM 模块的信息  
         .wd_i(mem_wd_i),  
         .wreg_i(mem_wreg_i), 
         .wdata_i(mem_wdata_i), 
@@ -495,12 +524,12 @@ module openmips(
 		.mem_addr_i(mem_mem_addr_i),
 		.reg2_i(mem_reg2_i),
 		
-		//  memory Ϣ
+		// 来自 memory 的信息
 		.mem_data_i(ram_data_i),
 		
-		// LLbit_i  LLbit Ĵֵ
+		// LLbit_i 是 LLbit 寄存器的值
 		.LLbit_i(LLbit_o),
-		// һֵд׶οҪд LLbitԻҪһж
+		// 但不一定是最新值，回写阶段可能要写 LLbit，所以还要进一步判断
 		.wb_LLbit_we_i(wb_LLbit_we_i),
 		.wb_LLbit_value_i(wb_LLbit_value_i),
 		
@@ -516,19 +545,20 @@ module openmips(
 		.cp0_cause_i(cp0_cause),
 		.cp0_epc_i(cp0_epc),
 		
-		// д׶εָǷҪд CP0
+		// 回写阶段的指令是否要写 CP0，用来检测数据相关
   	    .wb_cp0_reg_we(wb_cp0_reg_we_i),
 		.wb_cp0_reg_write_addr(wb_cp0_reg_write_addr_i),
 		.wb_cp0_reg_data(wb_cp0_reg_data_i),	  
 		
 		.LLbit_we_o(mem_LLbit_we_o),
 		.LLbit_value_o(mem_LLbit_value_o),
+		.LLbit_addr_o(mem_LLbit_addr_o),
 		
 		.cp0_reg_we_o(mem_cp0_reg_we_o),
 		.cp0_reg_write_addr_o(mem_cp0_reg_write_addr_o),
 		.cp0_reg_data_o(mem_cp0_reg_data_o),		
         
-        // ͵ MEM/WB ģϢ 
+        // 送到 MEM/WB 模块的信息 
         .wd_o(mem_wd_o),  
         .wreg_o(mem_wreg_o), 
         .wdata_o(mem_wdata_o),
@@ -536,7 +566,7 @@ module openmips(
 		.lo_o(mem_lo_o),
 		.whilo_o(mem_whilo_o),
 		
-		// ͵ memory Ϣ
+		// 送到 memory 的信息
 		.mem_addr_o(ram_addr_o),
 		.mem_we_o(ram_we_o),
 		.mem_sel_o(ram_sel_o),
@@ -549,7 +579,7 @@ module openmips(
 		.current_inst_address_o(mem_current_inst_address_o)		
     ); 
  
-    // MEM/WB ģ 
+    // MEM/WB 模块例化 
     mem_wb mem_wb0( 
         .clk(clk),   
         .rst(rst), 
@@ -557,7 +587,7 @@ module openmips(
         .stall(stall),
         .flush(flush),
         
-        // Էô׶ MEM ģϢ  
+        // 来自访存阶段 MEM 模块的信息  
         .mem_wd(mem_wd_o), 
         .mem_wreg(mem_wreg_o), 
         .mem_wdata(mem_wdata_o), 
@@ -567,12 +597,13 @@ module openmips(
 		
 		.mem_LLbit_we(mem_LLbit_we_o),
 		.mem_LLbit_value(mem_LLbit_value_o),
+		.mem_LLbit_addr(mem_LLbit_addr_o),
 		
 		.mem_cp0_reg_we(mem_cp0_reg_we_o),
 		.mem_cp0_reg_write_addr(mem_cp0_reg_write_addr_o),
 		.mem_cp0_reg_data(mem_cp0_reg_data_o),	
         
-        // ͵д׶εϢ 
+        // 送到回写阶段的信息 
         .wb_wd(wb_wd_i),  
         .wb_wreg(wb_wreg_i), 
         .wb_wdata(wb_wdata_i),
@@ -582,6 +613,7 @@ module openmips(
 		
 		.wb_LLbit_we(wb_LLbit_we_i),
 		.wb_LLbit_value(wb_LLbit_value_i),
+		.wb_LLbit_addr(wb_LLbit_addr_i),
 		
 		.wb_cp0_reg_we(wb_cp0_reg_we_i),
 		.wb_cp0_reg_write_addr(wb_cp0_reg_write_addr_i),
@@ -592,12 +624,12 @@ module openmips(
 		.clk(clk),
 		.rst(rst),
 	
-		// д˿
+		// 写端口
 		.we(wb_whilo_i),
 		.hi_i(wb_hi_i),
 		.lo_i(wb_lo_i),
 	
-		// ˿ 1
+		// 读端口 1
 		.hi_o(hi),
 		.lo_o(lo)	
 	);
@@ -610,7 +642,7 @@ module openmips(
 		
 		.stallreq_from_if(stallreq_from_if),
 		.stallreq_from_id(stallreq_from_id),
-		.stallreq_from_ex(stallreq_from_ex),  // ִн׶εͣ
+		.stallreq_from_ex(stallreq_from_ex),  // 来自执行阶段的暂停请求
 		.stallreq_from_mem(stallreq_from_mem),
 		.new_pc(new_pc),
 	    .flush(flush),
@@ -636,11 +668,16 @@ module openmips(
 		.rst(rst),
 	    .flush(flush),
 	  
-		// д˿
+		// 写端口
 		.LLbit_i(wb_LLbit_value_i),
 		.we(wb_LLbit_we_i),
+		.LLaddr_i(wb_LLbit_addr_i),
+		
+		// 总线监听端口
+		.snoop_we_i(ll_snoop_we_i),
+		.snoop_addr_i(ll_snoop_addr_i),
 	
-		// ˿ 1
+		// 读端口 1
 		.LLbit_o(LLbit_o)
 	);
 	
@@ -670,23 +707,65 @@ module openmips(
 		.timer_int_o(timer_int_o)  			
 	);
 
+	tcm #(
+		.BaseAddr(`ITCMBaseAddr),
+		.AddrMask(`ITCMAddrMask),
+		.NumLog2(`ITCMNumLog2)
+	) itcm0(
+		.clk(clk),
+		
+		.iaddr_i(pc),
+		.ihit_o(itcm_ihit),
+		.inst_o(itcm_inst_o),
+		
+		// 数据侧端口用于把代码搬进 ITCM
+		.ce_i(ram_ce_o),
+		.we_i(ram_we_o),
+		.addr_i(ram_addr_o),
+		.sel_i(ram_sel_o),
+		.data_i(ram_data_o),
+		.hit_o(itcm_hit),
+		.data_o(itcm_data_o)
+	);
+	
+	tcm #(
+		.BaseAddr(`DTCMBaseAddr),
+		.AddrMask(`DTCMAddrMask),
+		.NumLog2(`DTCMNumLog2)
+	) dtcm0(
+		.clk(clk),
+		
+		// DTCM 不用于取指，指令侧端口悬空，综合时会被优化掉
+		.iaddr_i(`ZeroWord),
+		.ihit_o(),
+		.inst_o(),
+		
+		.ce_i(ram_ce_o),
+		.we_i(ram_we_o),
+		.addr_i(ram_addr_o),
+		.sel_i(ram_sel_o),
+		.data_i(ram_data_o),
+		.hit_o(dtcm_hit),
+		.data_o(dtcm_data_o)
+	);
+
 	wishbone_bus_if dwishbone_bus_if(
 		.clk(clk),
 		.rst(rst),
 	
-		// Կģ ctrl
+		// 来自控制模块 ctrl
 		.stall_i(stall),
 		.flush_i(flush),
 	
-		// CPU дϢ
-		.cpu_ce_i(ram_ce_o),
-		.cpu_data_i(ram_data_o),   //  CPU 
+		// CPU 侧读写操作信息
+		.cpu_ce_i(ram_ce_o & ~itcm_hit & ~dtcm_hit),  // 访问 TCM 时不发起总线操作
+		.cpu_data_i(ram_data_o),   // 来自 CPU 的数据
 		.cpu_addr_i(ram_addr_o),
 		.cpu_we_i(ram_we_o),
 		.cpu_sel_i(ram_sel_o),
-		.cpu_data_o(ram_data_i),
+		.cpu_data_o(dwishbone_ram_data),
 	
-		// Wishbone ߲ӿ
+		// Wishbone 总线侧接口
 		.wishbone_data_i(dwishbone_data_i),
 		.wishbone_ack_i(dwishbone_ack_i),
 		.wishbone_addr_o(dwishbone_addr_o),
@@ -696,26 +775,26 @@ module openmips(
 		.wishbone_stb_o(dwishbone_stb_o),
 		.wishbone_cyc_o(dwishbone_cyc_o),
 
-		.stallreq(stallreq_from_mem)	       
+		.stallreq(dwishbone_stallreq)	       
     );
 
 	wishbone_bus_if iwishbone_bus_if(
 		.clk(clk),
 		.rst(rst),
 	
-		// Կģctrl
+		// 来自控制模块ctrl
 		.stall_i(stall),
 		.flush_i(flush),
 	
-		// CPU дϢ
-		.cpu_ce_i(rom_ce),
+		// CPU 侧读写操作信息
+		.cpu_ce_i(rom_ce & ~itcm_ihit),  // 从 ITCM 取指时不发起总线操作
 		.cpu_data_i(32'h00000000),
 		.cpu_addr_i(pc),
 		.cpu_we_i(1'b0),
 		.cpu_sel_i(4'b1111),
-		.cpu_data_o(inst_i),
+		.cpu_data_o(iwishbone_inst),
 	
-		// Wishbone ߲ӿ
+		// Wishbone 总线侧接口
 		.wishbone_data_i(iwishbone_data_i),
 		.wishbone_ack_i(iwishbone_ack_i),
 		.wishbone_addr_o(iwishbone_addr_o),
@@ -0,0 +1,64 @@
+`include "defines.vh"
+
+// 紧耦合存储器 TCM：直接挂在处理器内部，不经过 wishbone_bus_if，访问不需要暂停流水线
+// 数据侧可读可写（启动代码通过 sw 把 .itcm/.dtcm 段搬进来），指令侧只读
+// 读操作与 inst_rom、data_ram 一样是组合逻辑，保证取指、访存都在一个周期内完成
+module tcm #(
+       parameter BaseAddr = 32'h0FFF0000,  // TCM 的基地址，必须按 TCM 大小对齐
+       parameter AddrMask = 32'hFFFFE000,  // 地址比较掩码，为 1 的位参与命中判断
+       parameter NumLog2  = 11             // 存储器的字数取 2 的对数，此处是 2K word（8KB）
+)(
+       input  wire                   clk,
+
+       // 指令侧读端口
+       input  wire[`InstAddrBus]     iaddr_i,   // 取指地址
+       output wire                   ihit_o,    // 取指地址落在 TCM 内
+       output wire[`InstBus]         inst_o,    // 读出的指令
+
+       // 数据侧读写端口
+       input  wire                   ce_i,      // 访存使能信号
+       input  wire                   we_i,      // 是否是写操作，为 1 表示是写操作
+       input  wire[`DataAddrBus]     addr_i,    // 要访问的地址
+       input  wire[3:0]              sel_i,     // 字节选择信号
+       input  wire[`DataBus]         data_i,    // 要写入的数据
+       output wire                   hit_o,     // 访存地址落在 TCM 内
+       output wire[`DataBus]         data_o     // 读出的数据
+);
+
+       // 定义四个字节数组，mem3 存放每个字的最高字节（大端模式下的低地址）
+       reg[`ByteWidth]  tcm_mem0[0:(1 << NumLog2) - 1];
+       reg[`ByteWidth]  tcm_mem1[0:(1 << NumLog2) - 1];
+       reg[`ByteWidth]  tcm_mem2[0:(1 << NumLog2) - 1];
+       reg[`ByteWidth]  tcm_mem3[0:(1 << NumLog2) - 1];
+
+       wire[NumLog2 - 1:0] iindex = iaddr_i[NumLog2 + 1:2];  // 字地址
+       wire[NumLog2 - 1:0] index  = addr_i[NumLog2 + 1:2];
+
+       assign ihit_o = ((iaddr_i & AddrMask) == BaseAddr);
+       assign hit_o  = (ce_i == `ChipEnable) && ((addr_i & AddrMask) == BaseAddr);
+
+       // 写操作：访存阶段的指令只会停留一个周期，即使被暂停重复写入同样的数据也没有影响
+       always @ (posedge clk) begin
+           if((hit_o == 1'b1) && (we_i == `WriteEnable)) begin
+               if (sel_i[3] == 1'b1) begin
+                   tcm_mem3[index] <= data_i[31:24];
+               end
+               if (sel_i[2] == 1'b1) begin
+                   tcm_mem2[index] <= data_i[23:16];
+               end
+               if (sel_i[1] == 1'b1) begin
+                   tcm_mem1[index] <= data_i[15:8];
+               end
+               if (sel_i[0] == 1'b1) begin
+                   tcm_mem0[index] <= data_i[7:0];
+               end
+           end
+       end
+
+       // 读操作
+       assign inst_o = (ihit_o == 1'b1) ?
+                       {tcm_mem3[iindex], tcm_mem2[iindex], tcm_mem1[iindex], tcm_mem0[iindex]} : `ZeroWord;
+       assign data_o = (hit_o == 1'b1 && we_i == `WriteDisable) ?
+                       {tcm_mem3[index], tcm_mem2[index], tcm_mem1[index], tcm_mem0[index]} : `ZeroWord;
+
+endmodule
@@ -0,0 +1,37 @@
+`timescale 1ns / 1ps
+`include "defines.vh"
+
+// 片上启动 ROM：用 BRAM 存放 BootLoader，挂在 Wishbone 总线互联矩阵上
+// 复位后处理器直接从这里全速取指，只有 OS 镜像的复制才需要访问 SPI Flash
+module boot_rom(
+    // Wishbone 总线接口
+    input wire wb_clk_i,        // Wishbone 时钟
+    input wire wb_rst_i,        // Wishbone 复位
+    input wire wb_cyc_i,        // Wishbone 总线周期有效
+    input wire wb_stb_i,        // Wishbone 选通信号
+    input wire wb_we_i,         // Wishbone 写使能，ROM 忽略写操作
+    input wire [3:0] wb_sel_i,  // Wishbone 字节选择
+    input wire [31:0] wb_adr_i, // Wishbone 地址
+    input wire [31:0] wb_dat_i, // Wishbone 写数据
+    output reg [31:0] wb_dat_o, // Wishbone 读数据
+    output reg        wb_ack_o  // Wishbone 应答
+    );
+
+// BootLoader 的机器码，由 bootloader 目录下 make 生成的 BootLoader.data 初始化
+(* rom_style = "block" *) reg [31:0] boot_mem[0:(1 << `BootRomNumLog2) - 1];
+
+initial $readmemh(`BootRomInitFile, boot_mem);
+
+// BRAM 为同步读，选通后的下一个周期给出数据和应答，应答只保持一个周期
+always @ (posedge wb_clk_i) begin
+    if(wb_rst_i) begin
+        wb_ack_o <= 1'b0;
+        wb_dat_o <= 32'h00000000;
+    end
+    else begin
+        wb_ack_o <= wb_cyc_i & wb_stb_i & ~wb_ack_o;
+        wb_dat_o <= boot_mem[wb_adr_i[`BootRomNumLog2 + 1:2]];
+    end
+end
+
+endmodule
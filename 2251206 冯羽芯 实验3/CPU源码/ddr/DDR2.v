@@ -2,21 +2,34 @@
 
 `include"defines.vh"
 
-// DDR2 ģ飬Wishbone ߽ӿ + DDR2 ӿ
+// DDR2 控制器顶层模块，Wishbone 总线接口 + DDR2 物理接口
+// 有两个 Wishbone 端口：数据端口可读可写，经总线互联矩阵连接处理器数据总线和 DMA；
+// 指令端口只读，直接连接处理器的指令总线，两个端口的访问在控制器内部交替进行
 module DDR2(
-    input wire wb_clk_i,            // Wishbone ʱ
-    input wire wb_rst_i,            // Wishbone λ
-    input wire wb_cyc_i,            // Wishbone Ч
-    input wire wb_stb_i,            // Wishbone ѡͨź
-    input wire wb_we_i,             // Wishbone дʹ
-    input wire [3:0] wb_sel_i,      // Wishbone ֽѡ
-    input wire [26:0] wb_adr_i,     // Wishbone ַ
-    input wire [31:0] wb_dat_i,     // Wishbone д
-    output reg [31:0] wb_dat_o,     // Wishbone 
-    output reg        wb_ack_o,     // Wishbone Ӧ
-    output reg init_calib_complete, // DDR2 ʼɱ־
+    input wire wb_clk_i,            // Wishbone 时钟
+    input wire wb_rst_i,            // Wishbone 复位
+
+    // 数据端口
+    input wire wb_cyc_i,            // Wishbone 总线周期有效
+    input wire wb_stb_i,            // Wishbone 选通信号
+    input wire wb_we_i,             // Wishbone 写使能
+    input wire [3:0] wb_sel_i,      // Wishbone 字节选择
+    input wire [26:0] wb_adr_i,     // Wishbone 地址
+    input wire [31:0] wb_dat_i,     // Wishbone 写数据
+    output reg [31:0] wb_dat_o,     // Wishbone 读数据
+    output reg        wb_ack_o,     // Wishbone 应答
+
+    // 指令端口，只读
+    input wire wbi_cyc_i,
+    input wire wbi_stb_i,
+    input wire [26:0] wbi_adr_i,
+    output reg [31:0] wbi_dat_o,
+    output reg        wbi_ack_o,
+
+    output reg init_calib_complete, // DDR2 初始化完成标志
+    output wire wq_empty_o,         // 写队列已排空，所有已应答的写操作都已写入 DDR2
     
-    // DDR2 SDRAM ӿź
+    // DDR2 SDRAM 物理接口信号
     output   [12:0] ddr2_addr,
     output   [2:0] ddr2_ba,
     output   ddr2_ras_n,
@@ -41,7 +54,7 @@ module DDR2(
     // 22:0
     //8 banks
     
-    // 
+    // 最大块数、计数器等
     reg [22:0] max_block=0;
     reg [26:0] timercnt=0;
     reg [11:0] timerval=0;
@@ -72,24 +85,26 @@ module DDR2(
     wire [31:0] mem_dq_i_w;
     assign mem_dq_i_w=mem_dq_i;
     wire [31:0] mem_dq_o;
+    wire [127:0] mem_line;   // Ram2Ddr 读回的一整个突发，包含 4 个连续的字
 
-    reg mem_cen;
     reg mem_oen;
     reg mem_wen;
-    wire mem_cen_w;
     wire mem_oen_w;
     wire mem_wen_w;
-    assign mem_cen_w=mem_cen;
     assign mem_oen_w=mem_oen;
     assign mem_wen_w=mem_wen;
     
+    // 与 Ram2Ddr 之间的请求/完成握手：每次访问翻转一次 mem_req，
+    // Ram2Ddr 完成后把 mem_done 置为与 mem_req 相同的值
+    reg  mem_req = 1'b0;
+    wire mem_done;
+    (* ASYNC_REG = "TRUE" *) reg [1:0] mem_done_sync = 2'b00;  // 同步到 Wishbone 时钟域
     
     wire mem_ub;
     wire mem_lb;
-    wire [3:0]mem_sel;
+    reg [3:0]mem_sel;
     assign mem_ub = 0;
     assign mem_lb = 0;
-    assign mem_sel= ~wb_sel_i;
     
     wire [15:0] chipTemp;
 
@@ -101,7 +116,7 @@ module DDR2(
     wire [22:0] block44KHz;
     
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
-////    ʱӹģ100MHz200MHzʱӣ
+////    时钟管理模块例化（产生100MHz和200MHz时钟）
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
     wire clk_out2_200MHZ;
     wire clk_out_100MHZ;
@@ -117,7 +132,7 @@ module DDR2(
     );     
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
-////    DDR2Ram2Ddrģ飬WishboneDDR2Эת
+////    DDR2控制器例化（Ram2Ddr模块，负责Wishbone到DDR2的协议转换和物理操作）
 //////////////////////////////////////////////////////////////////////////////////////////////////////// 
     wire init_calib_complete_w;
     Ram2Ddr Ram(
@@ -129,7 +144,9 @@ module DDR2(
         .ram_a                 (mem_a_w),
         .ram_dq_i              (mem_dq_i_w),
         .ram_dq_o              (mem_dq_o),
-        .ram_cen               (mem_cen_w),
+        .ram_line_o            (mem_line),
+        .ram_req               (mem_req),
+        .ram_done              (mem_done),
         .ram_oen               (mem_oen_w),
         .ram_wen               (mem_wen_w),
         .ram_ub                (mem_ub),
@@ -166,105 +183,330 @@ module DDR2(
 
     //----------------------------wishbone -------------------------------------
     parameter IDLE = 5'd0;
-    parameter START = 5'd1;
-    parameter WRITE = 5'd2;
-    parameter READ = 5'd3;
-    parameter WAIT = 5'd4;
-    parameter ENDING = 5'd5;
+    parameter WAIT = 5'd1;
 
-    reg [4:0] state;
-    reg [4:0] next_state;
-    reg [15:0] wait_count;
+    reg [4:0] state = IDLE;         // 与 Ram2Ddr 握手的状态
 
-    // ״̬̣ Wishbone źź͵ǰ״̬л
-    always @ (posedge wb_clk_i or posedge wb_rst_i) begin
-       if(wb_rst_i)begin
-           state    <= IDLE;
-           wb_ack_o <= 1'b0;
-           init_calib_complete     <= 1'b0; // 踴λʱΪ 0
-       end 
-       else if(wb_cyc_i & wb_stb_i)begin
-           state    <= next_state;
-           if(state == ENDING && !wb_ack_o)begin
-               wb_ack_o <= 1'b1; // ʱӦ
-           end
-       end
-       else begin
-           state    <= IDLE;
-           wb_ack_o <= 1'b0;
-       end
-       init_calib_complete <= init_calib_complete_w; // DDR2 ʼɱ־ͬ
-    end
+    // 后台操作的来源，也用于轮转仲裁
+    parameter SRC_DRD = 2'd0;       // 数据端口的读操作
+    parameter SRC_IRD = 2'd1;       // 指令端口的读操作
+    parameter SRC_WR  = 2'd2;       // 写队列
+    parameter SRC_NONE = 2'd3;
 
-    // ״̬ź
-    always @ (posedge wb_clk_i or posedge wb_rst_i) begin
-        if(wb_rst_i)begin
-            next_state <= IDLE;
-            mem_cen    <= 1'b1;
-            mem_oen    <= 1'b1;
-            mem_wen    <= 1'b1;
-        end
-        else begin
-            case(state)
-            IDLE: // Уȴ Wishbone 
-            begin
-                mem_cen    <= 1'b1; // ƬѡЧ
-                mem_oen    <= 1'b1; // Ч
-                mem_wen    <= 1'b1; // дЧ
-                wait_count <= 16'b0;
-                next_state <= START;
-            end
+    reg [1:0] mem_src  = SRC_NONE;  // 正在进行的后台操作
+    reg [1:0] arb_last = SRC_WR;    // 上一次被选中的来源
+    reg [1:0] grant;
 
-            START: // յWishbone׼/д
-            begin
-                mem_a          <= wb_adr_i; // ַ
-                if(wb_we_i)
-                    next_state <= WRITE; // д
-                else 
-                    next_state <= READ;  // 
-            end 
-
-            WRITE: // дݵ DDR2
-            begin
-                mem_cen    <= 1'b0; // ƬѡЧ
-                mem_oen    <= 1'b1; // Ч
-                mem_wen    <= 1'b0; // дʹ
-                mem_a      <= wb_adr_i;
-                mem_dq_i   <= wb_dat_i; // д
-                wait_count <= wait_count + 16'd1;
-                if(wait_count >= 16'd80) // ȴд
-                begin
-                    mem_cen <= 1'b1;
-                    mem_oen <= 1'b1;
-                    mem_wen <= 1'b1;
-                    next_state <= ENDING;
+    // 行缓冲：每个端口一个，保存该端口最近一次读回的 16 字节，之后对同一行的读操作 
+    // 直接从这里返回，不再访问 DDR2。顺序取指、顺序复制时 4 次读操作只需要一次 DDR2 
+    // 访问。写操作落在行缓冲内时同时更新两个行缓冲，所以行缓冲总是包含写队列中的数据
+    reg [127:0] line_buf;
+    reg [22:0]  line_tag;           // 行缓冲对应的地址 [26:4]
+    reg         line_valid = 1'b0;
+    reg [127:0] iline_buf;
+    reg [22:0]  iline_tag;
+    reg         iline_valid = 1'b0;
+
+    wire        line_hit   = line_valid  && (line_tag  == wb_adr_i[26:4]);
+    wire        iline_hit  = iline_valid && (iline_tag == wbi_adr_i[26:4]);
+    wire        iline_wr   = iline_valid && (iline_tag == wb_adr_i[26:4]);  // 数据端口写指令行缓冲
+
+    // 指令端口的读操作已经交给 Ram2Ddr 之后，数据端口又写了同一行，读回的整行已经过时，
+    // 只返回请求的字（它先于这次写操作），不放入行缓冲
+    reg         fill_stale = 1'b0;
+
+    // 写队列：写操作进入队列后下一个周期就给出应答，由后台依次写入 DDR2。
+    // 对同一个字的写操作合并到队列中已有的表项。队首随时可能被交给 Ram2Ddr，
+    // 不参与合并，所以除队首外每个字最多只有一个表项
+    parameter WQ_DEPTH_LOG2 = 2;
+    parameter WQ_DEPTH      = 1 << WQ_DEPTH_LOG2;
+
+    reg [24:0] wq_addr[0:WQ_DEPTH - 1];  // 字地址 [26:2]
+    reg [3:0]  wq_sel[0:WQ_DEPTH - 1];
+    reg [31:0] wq_data[0:WQ_DEPTH - 1];
+    reg [WQ_DEPTH_LOG2 - 1:0] wq_rd = 0;  // 队首
+    reg [WQ_DEPTH_LOG2 - 1:0] wq_wr = 0;  // 队尾
+    reg [WQ_DEPTH_LOG2:0]     wq_count = 0;
+
+    wire wq_full  = (wq_count == WQ_DEPTH);
+    assign wq_empty_o = (wq_count == 0);
+
+    // 没有命中行缓冲、也不能转发的读操作，等待后台读 DDR2
+    // 等待期间主设备撤销了总线周期（流水线因异常被清除），读回后不再应答，
+    // 避免把应答错给主设备随后发起的另一次访问
+    reg         rd_pending = 1'b0;
+    reg         rd_abort   = 1'b0;
+    reg [26:0]  rd_addr;
+    reg         ird_pending = 1'b0;
+    reg         ird_abort   = 1'b0;
+    reg [26:0]  ird_addr;
+
+    // 在写队列中查找：合并、转发的表项，以及与读操作同一行、必须先写入 DDR2 的表项。
+    // 读操作不会越过同一行的写操作，两个端口看到的存储器内容总是一致的
+    reg                       wq_merge;     // 数据端口的地址有可以合并、转发的表项
+    reg [WQ_DEPTH_LOG2 - 1:0] wq_merge_idx;
+    reg                       iwq_match;    // 指令端口的地址有可以转发的表项
+    reg [WQ_DEPTH_LOG2 - 1:0] iwq_match_idx;
+    reg                       rd_conflict;  // 队列中有与 rd_addr 同一行的写操作
+    reg                       ird_conflict; // 队列中有与 ird_addr 同一行的写操作
+    integer k;
+
+    always @ (*) begin
+        wq_merge      = 1'b0;
+        wq_merge_idx  = 0;
+        iwq_match     = 1'b0;
+        iwq_match_idx = 0;
+        rd_conflict   = 1'b0;
+        ird_conflict  = 1'b0;
+        for(k = 0; k < WQ_DEPTH; k = k + 1) begin
+            if(((k - wq_rd) & (WQ_DEPTH - 1)) < wq_count) begin
+                if(k != wq_rd && wq_addr[k] == wb_adr_i[26:2]) begin
+                    wq_merge      = 1'b1;
+                    wq_merge_idx  = k;
+                end
+                if(k != wq_rd && wq_addr[k] == wbi_adr_i[26:2]) begin
+                    iwq_match     = 1'b1;
+                    iwq_match_idx = k;
+                end
+                if(wq_addr[k][24:2] == rd_addr[26:4]) begin
+                    rd_conflict   = 1'b1;
+                end
+                if(wq_addr[k][24:2] == ird_addr[26:4]) begin
+                    ird_conflict  = 1'b1;
                 end
             end
+        end
+    end
 
-            READ: //  DDR2 
-            begin
-                mem_cen    <= 1'b0; // ƬѡЧ
-                mem_oen    <= 1'b0; // ʹ
-                mem_wen    <= 1'b1; // дЧ
-                mem_a      <= wb_adr_i;
-                wait_count <= wait_count + 16'd1;
-                if(wait_count >= 16'd80) // ȴ
-                begin
-                    mem_cen    <= 1'b1;
-                    mem_oen    <= 1'b1;
-                    mem_wen    <= 1'b1;
-                    wb_dat_o   <= mem_dq_o; // 
-                    next_state <= ENDING;
-                end
+    // 读操作命中写队列中完整的字，直接转发
+    wire wq_fwd  = wq_merge  && (wq_sel[wq_merge_idx]  == 4'b1111);
+    wire iwq_fwd = iwq_match && (wq_sel[iwq_match_idx] == 4'b1111);
+
+    wire wb_req  = wb_cyc_i & wb_stb_i & ~wb_ack_o & ~rd_pending;
+    wire wbi_req = wbi_cyc_i & wbi_stb_i & ~wbi_ack_o & ~ird_pending;
+    wire wq_push = wb_req & wb_we_i & ~wq_merge & ~wq_full;
+    wire wq_pop  = (state == WAIT) && (mem_done_sync[1] == mem_req) && (mem_src == SRC_WR);
+
+    // 本周期数据端口的写操作落在正在读取的行内，或者落在本周期刚选中的指令端口读操作的行内
+    // （这个写操作排在读操作之后，ird_conflict 只检查已经在队列中的表项）。数据端口有读操作
+    // 等待时不会再发起写操作，所以 IDLE 时只需要检查指令端口
+    wire wr_fill_line = wb_req & wb_we_i & (wq_merge | ~wq_full) &
+                        (((state == WAIT) & (mem_src != SRC_WR) & (wb_adr_i[26:4] == mem_a[26:4])) |
+                         ((state == IDLE) & (grant == SRC_IRD) & (wb_adr_i[26:4] == ird_addr[26:4])));
+
+    // 后台的三个来源轮转仲裁：从上一次被选中的来源的下一个开始，选第一个可以进行的。
+    // 读操作遇到同一行的写操作时等待，写队列总能排空，所以不会死锁
+    wire drd_ok = rd_pending  & ~rd_conflict;
+    wire ird_ok = ird_pending & ~ird_conflict;
+    wire wr_ok  = (wq_count != 0);
+
+    always @ (*) begin
+        grant = SRC_NONE;
+        case(arb_last)
+        SRC_DRD: grant = ird_ok ? SRC_IRD : wr_ok  ? SRC_WR  : drd_ok ? SRC_DRD : SRC_NONE;
+        SRC_IRD: grant = wr_ok  ? SRC_WR  : drd_ok ? SRC_DRD : ird_ok ? SRC_IRD : SRC_NONE;
+        default: grant = drd_ok ? SRC_DRD : ird_ok ? SRC_IRD : wr_ok  ? SRC_WR  : SRC_NONE;
+        endcase
+    end
+
+    // 写队列与行缓冲的存储部分
+    always @ (posedge wb_clk_i) begin
+        if(wb_req & wb_we_i) begin
+            if(wq_merge) begin
+                wq_data[wq_merge_idx] <= {wb_sel_i[3] ? wb_dat_i[31:24] : wq_data[wq_merge_idx][31:24],
+                                          wb_sel_i[2] ? wb_dat_i[23:16] : wq_data[wq_merge_idx][23:16],
+                                          wb_sel_i[1] ? wb_dat_i[15:8]  : wq_data[wq_merge_idx][15:8],
+                                          wb_sel_i[0] ? wb_dat_i[7:0]   : wq_data[wq_merge_idx][7:0]};
+                wq_sel[wq_merge_idx]  <= wq_sel[wq_merge_idx] | wb_sel_i;
             end
-            
-            ENDING: // ȴ Wishbone Ӧ
-            begin
+            else if(~wq_full) begin
+                wq_addr[wq_wr] <= wb_adr_i[26:2];
+                wq_sel[wq_wr]  <= wb_sel_i;
+                wq_data[wq_wr] <= wb_dat_i;
             end
+        end
+    end
+
+    // Wishbone 侧：写操作进入写队列，读操作依次尝试行缓冲、写队列转发、后台读 DDR2。
+    // 后台：与 Ram2Ddr 两相握手，锁存命令后翻转 mem_req，等到同步过来的 mem_done 与
+    // mem_req 相同就完成，访问延迟取决于 DDR2 实际完成的时间
+    always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+       if(wb_rst_i)begin
+           state         <= IDLE;
+           mem_src       <= SRC_NONE;
+           arb_last      <= SRC_WR;
+           wb_ack_o      <= 1'b0;
+           wb_dat_o      <= 32'h00000000;
+           wbi_ack_o     <= 1'b0;
+           wbi_dat_o     <= 32'h00000000;
+           mem_oen       <= 1'b1;
+           mem_wen       <= 1'b1;
+           mem_req       <= 1'b0;
+           mem_done_sync <= 2'b00;
+           line_valid    <= 1'b0;
+           iline_valid   <= 1'b0;
+           wq_rd         <= 0;
+           wq_wr         <= 0;
+           wq_count      <= 0;
+           rd_pending    <= 1'b0;
+           rd_abort      <= 1'b0;
+           ird_pending   <= 1'b0;
+           ird_abort     <= 1'b0;
+           fill_stale    <= 1'b0;
+           init_calib_complete     <= 1'b0; // 假设复位时为 0
+       end 
+       else begin
+           wb_ack_o      <= 1'b0;           // 应答只保持一个周期
+           wbi_ack_o     <= 1'b0;
+           mem_done_sync <= {mem_done_sync[0], mem_done};
+
+           // ---------------- 数据端口 ----------------
+           if(wb_req) begin
+               if(wb_we_i) begin
+                   if(wq_merge | ~wq_full) begin
+                       wb_ack_o <= 1'b1;    // 写队列满且不能合并时暂不应答
+                       if(line_hit) begin   // 更新行缓冲中对应的字节
+                           if(wb_sel_i[3]) line_buf[{wb_adr_i[3:2], 5'd24} +: 8] <= wb_dat_i[31:24];
+                           if(wb_sel_i[2]) line_buf[{wb_adr_i[3:2], 5'd16} +: 8] <= wb_dat_i[23:16];
+                           if(wb_sel_i[1]) line_buf[{wb_adr_i[3:2], 5'd8}  +: 8] <= wb_dat_i[15:8];
+                           if(wb_sel_i[0]) line_buf[{wb_adr_i[3:2], 5'd0}  +: 8] <= wb_dat_i[7:0];
+                       end
+                       if(iline_wr) begin   // 写入的是代码（加载程序等），同样更新指令端口的行缓冲
+                           if(wb_sel_i[3]) iline_buf[{wb_adr_i[3:2], 5'd24} +: 8] <= wb_dat_i[31:24];
+                           if(wb_sel_i[2]) iline_buf[{wb_adr_i[3:2], 5'd16} +: 8] <= wb_dat_i[23:16];
+                           if(wb_sel_i[1]) iline_buf[{wb_adr_i[3:2], 5'd8}  +: 8] <= wb_dat_i[15:8];
+                           if(wb_sel_i[0]) iline_buf[{wb_adr_i[3:2], 5'd0}  +: 8] <= wb_dat_i[7:0];
+                       end
+                   end
+                   if(wq_push) begin
+                       wq_wr <= wq_wr + 1'b1;
+                   end
+                   if(wr_fill_line) begin
+                       fill_stale <= 1'b1;
+                   end
+               end
+               else if(line_hit) begin
+                   // 读命中行缓冲，下一个周期就给出应答
+                   wb_dat_o <= line_buf[{wb_adr_i[3:2], 5'b00000} +: 32];
+                   wb_ack_o <= 1'b1;
+               end
+               else if(wq_fwd) begin
+                   // 读命中写队列，转发尚未写入 DDR2 的数据
+                   wb_dat_o <= wq_data[wq_merge_idx];
+                   wb_ack_o <= 1'b1;
+               end
+               else begin
+                   rd_pending <= 1'b1;
+                   rd_abort   <= 1'b0;
+                   rd_addr    <= wb_adr_i;
+               end
+           end
+           else if(rd_pending & ~wb_cyc_i) begin
+               rd_abort <= 1'b1;
+           end
 
-            endcase
-        end 
+           wq_count <= wq_count + wq_push - wq_pop;
+
+           // ---------------- 指令端口 ----------------
+           if(wbi_req) begin
+               if(iline_hit) begin
+                   wbi_dat_o <= iline_buf[{wbi_adr_i[3:2], 5'b00000} +: 32];
+                   wbi_ack_o <= 1'b1;
+               end
+               else if(iwq_fwd) begin
+                   wbi_dat_o <= wq_data[iwq_match_idx];
+                   wbi_ack_o <= 1'b1;
+               end
+               else begin
+                   ird_pending <= 1'b1;
+                   ird_abort   <= 1'b0;
+                   ird_addr    <= wbi_adr_i;
+               end
+           end
+           else if(ird_pending & ~wbi_cyc_i) begin
+               ird_abort <= 1'b1;
+           end
 
+           // ---------------- DDR2 侧 ----------------
+           case(state)
+           IDLE: // 空闲，选择下一个要交给 Ram2Ddr 的操作
+           begin
+               // Ram2Ddr 对 mem_req 做了两级同步，而地址、数据只寄存一级，
+               // 所以可以与 mem_req 在同一个周期给出
+               if(grant != SRC_NONE) begin
+                   mem_req    <= ~mem_req;
+                   mem_src    <= grant;
+                   arb_last   <= grant;
+                   fill_stale <= wr_fill_line;  // 同一个周期写入该行的数据不在读回的整行中
+                   state      <= WAIT;
+               end
+               case(grant)
+               SRC_DRD:
+               begin
+                   mem_a    <= rd_addr;     // 地址锁存
+                   mem_wen  <= 1'b1;
+                   mem_oen  <= 1'b0;        // 输出使能
+               end
+               SRC_IRD:
+               begin
+                   mem_a    <= ird_addr;
+                   mem_wen  <= 1'b1;
+                   mem_oen  <= 1'b0;
+               end
+               SRC_WR:
+               begin
+                   mem_a    <= {wq_addr[wq_rd], 2'b00};
+                   mem_dq_i <= wq_data[wq_rd];      // 写数据
+                   mem_sel  <= ~wq_sel[wq_rd];      // 写屏蔽，为 1 的字节不写
+                   mem_wen  <= 1'b0;        // 写使能
+                   mem_oen  <= 1'b1;
+               end
+               default:
+               begin
+               end
+               endcase
+           end
+
+           WAIT: // 等待 DDR2 完成读写
+           begin
+               if(mem_done_sync[1] == mem_req) begin
+                   case(mem_src)
+                   SRC_WR:                  // 写操作，弹出队首
+                   begin
+                       wq_rd <= wq_rd + 1'b1;
+                   end
+                   SRC_DRD:                 // 读操作，应答并把整行放入行缓冲
+                   begin
+                       wb_dat_o    <= mem_dq_o;
+                       // 数据端口经过总线互联矩阵，还要确认仍是同一个读操作
+                       wb_ack_o    <= ~rd_abort & wb_cyc_i & wb_stb_i & ~wb_we_i &
+                                      (wb_adr_i == rd_addr);
+                       rd_pending  <= 1'b0;
+                       line_buf    <= mem_line;
+                       line_tag    <= mem_a[26:4];
+                       line_valid  <= ~(fill_stale | wr_fill_line);
+                   end
+                   default:
+                   begin
+                       wbi_dat_o   <= mem_dq_o;
+                       wbi_ack_o   <= ~ird_abort & wbi_cyc_i;
+                       ird_pending <= 1'b0;
+                       iline_buf   <= mem_line;
+                       iline_tag   <= mem_a[26:4];
+                       iline_valid <= ~(fill_stale | wr_fill_line);
+                   end
+                   endcase
+                   state <= IDLE;
+               end
+           end
+
+           default:
+           begin
+               state <= IDLE;
+           end
+           endcase
+       end
+       init_calib_complete <= init_calib_complete_w; // DDR2 初始化完成标志同步
     end
 
 
@@ -35,7 +35,9 @@ entity Ram2Ddr is
       ram_a                : in    std_logic_vector(26 downto 0);
       ram_dq_i             : in    std_logic_vector(31 downto 0);
       ram_dq_o             : out   std_logic_vector(31 downto 0);
-      ram_cen              : in    std_logic;
+      ram_line_o           : out   std_logic_vector(127 downto 0); -- whole burst
+      ram_req              : in    std_logic; -- toggles once per request
+      ram_done             : out   std_logic; -- follows 'ram_req' when done
       ram_oen              : in    std_logic;
       ram_wen              : in    std_logic;
       ram_ub               : in    std_logic;
@@ -116,7 +118,7 @@ end component;
 ------------------------------------------------------------------------
 -- FSM
 type state_type is (stIdle, stPreset, stSendData, stSetCmdRd, stSetCmdWr,
-                    stWaitCen);
+                    stWaitRd);
 
 ------------------------------------------------------------------------
 -- Constant Declarations
@@ -141,7 +143,10 @@ signal sreg                : std_logic_vector(1 downto 0);
 -- ram internal signals
 signal ram_a_int           : std_logic_vector(26 downto 0);
 signal ram_dq_i_int        : std_logic_vector(31 downto 0);
-signal ram_cen_int         : std_logic;
+signal ram_req_sreg        : std_logic_vector(1 downto 0) := "00";
+signal ram_req_sync        : std_logic;
+signal ram_req_ack         : std_logic := '0'; -- last accepted 'ram_req'
+signal ram_done_int        : std_logic := '0';
 signal ram_oen_int         : std_logic;
 signal ram_wen_int         : std_logic;
 signal ram_ub_int          : std_logic;
@@ -173,6 +178,7 @@ attribute FSM_ENCODING of cState    : signal is "GRAY";
 
 attribute ASYNC_REG                 : string;
 attribute ASYNC_REG of sreg         : signal is "TRUE";
+attribute ASYNC_REG of ram_req_sreg : signal is "TRUE";
 
 ------------------------------------------------------------------------
 -- Module Implementation
@@ -244,7 +250,7 @@ begin
       if rising_edge(mem_ui_clk) then
          ram_a_int <= ram_a;
          ram_dq_i_int <= ram_dq_i;
-         ram_cen_int <= ram_cen;
+         ram_req_sreg <= ram_req_sreg(0) & ram_req;
          ram_oen_int <= ram_oen;
          ram_wen_int <= ram_wen;
          ram_ub_int <= ram_ub;
@@ -253,6 +259,10 @@ begin
       end if;
    end process REG_IN;
    
+   -- 'ram_req' is double registered, so by the time its toggle is seen
+   -- the singly registered address, data and controls have settled
+   ram_req_sync <= ram_req_sreg(1);
+   
 ------------------------------------------------------------------------
 -- State Machine
 ------------------------------------------------------------------------
@@ -269,15 +279,16 @@ begin
    end process SYNC_PROCESS;
 
 -- Next state logic
-   NEXT_STATE_DECODE: process(cState, calib_complete, ram_cen_int, 
-   mem_rdy, mem_wdf_rdy, ram_wen_int, ram_oen_int)
+   NEXT_STATE_DECODE: process(cState, calib_complete, ram_req_sync, 
+   ram_req_ack, mem_rdy, mem_wdf_rdy, ram_wen_int, ram_oen_int, 
+   mem_rd_data_valid, mem_rd_data_end)
    begin
       nState <= cState;
       case(cState) is
-         -- If calibration is done successfully and CEN is
-         -- deasserted then start a new transaction
+         -- If calibration is done successfully and 'ram_req'
+         -- has toggled then start a new transaction
          when stIdle =>
-            if ram_cen_int = '0' and 
+            if ram_req_sync /= ram_req_ack and 
                calib_complete = '1' then
                nState <= stPreset;
             end if;
@@ -302,26 +313,55 @@ begin
          -- frag to be asserted (in case it's not)
          when stSetCmdRd =>
             if mem_rdy = '1' then
-               nState <= stWaitCen;
+               nState <= stWaitRd;
             end if;
          -- Sending the write command after the data has been
          -- written to the controller FIFO and wait ro the
-         -- 'mem_rdy' frag to be asserted (in case it's not)
+         -- 'mem_rdy' frag to be asserted (in case it's not).
+         -- Once accepted, the controller keeps the write ordered
+         -- against later requests, so the write is done here
          when stSetCmdWr =>
             if mem_rdy = '1' then
-               nState <= stWaitCen;
+               nState <= stIdle;
             end if;
-         -- After sending all the control signals and data, we
-         -- wait for the external CEN to signal transaction
-         -- end
-         when stWaitCen =>
-            if ram_cen_int = '1' then
+         -- Wait for the read data to come back from the
+         -- controller
+         when stWaitRd =>
+            if mem_rd_data_valid = '1' and mem_rd_data_end = '1' then
                nState <= stIdle;
             end if;
          when others => nState <= stIdle;            
       end case;      
    end process;
 
+------------------------------------------------------------------------
+-- Request/done handshake: 'ram_done' is set to the accepted 'ram_req'
+-- value once the write command is accepted or the read data has been
+-- registered to 'ram_dq_o', so the requester can sample the data as
+-- soon as it sees the toggle. Row hits are handled by the controller's
+-- bank machines, which keep rows open between requests
+------------------------------------------------------------------------
+   HANDSHAKE: process(mem_ui_clk)
+   begin
+      if rising_edge(mem_ui_clk) then
+         if mem_ui_rst = '1' then
+            ram_req_ack <= '0';
+            ram_done_int <= '0';
+         else
+            if cState = stIdle and nState = stPreset then
+               ram_req_ack <= ram_req_sync;
+            end if;
+            if (cState = stSetCmdWr and mem_rdy = '1') or
+               (cState = stWaitRd and mem_rd_data_valid = '1' and
+                mem_rd_data_end = '1') then
+               ram_done_int <= ram_req_ack;
+            end if;
+         end if;
+      end if;
+   end process HANDSHAKE;
+   
+   ram_done <= ram_done_int;
+
 ------------------------------------------------------------------------
 -- Generating the FIFO control and command signals according to the 
 -- current state of the FSM
@@ -352,27 +392,27 @@ begin
    end process MEM_CTL;
    
 ------------------------------------------------------------------------
--- Decoding the least significant 3 bits of the address and creating
--- accordingly the 'mem_wdf_mask'
+-- Decoding the word address bits 3..2 and creating accordingly the
+-- 'mem_wdf_mask'. One burst holds 4 consecutive 32-bit words
 ------------------------------------------------------------------------
    WR_DATA_MSK: process(mem_ui_clk)
    begin
       if rising_edge(mem_ui_clk) then
          if cState = stPreset then
-            case(ram_a_int(2 downto 0)) is
-               when "000" =>
+            case(ram_a_int(3 downto 2)) is
+               when "00" =>
                      -- 32-bit
                      mem_wdf_mask <= "111111111111"&ram_sel_int;
-               when "010" => 
+               when "01" => 
                      -- 32-bit
                      mem_wdf_mask <= "11111111"&ram_sel_int&"1111";
 
-               when "100" =>
-                     -- 16-bit
+               when "10" =>
+                     -- 32-bit
                      mem_wdf_mask <= "1111"&ram_sel_int&"11111111";
 
-               when "110" =>
-                      -- 16-bit
+               when "11" =>
+                     -- 32-bit
                      mem_wdf_mask <= ram_sel_int&"111111111111";
              
                when others => null;
@@ -398,7 +438,9 @@ begin
    begin
       if rising_edge(mem_ui_clk) then
          if cState = stPreset then
-            mem_addr <= ram_a_int(26 downto 3) & "000";
+            -- 'ram_a' is a byte address, the controller counts 16-bit
+            -- columns and a burst of 8 columns covers 16 bytes
+            mem_addr <= '0' & ram_a_int(26 downto 4) & "000";
          end if;
       end if;
    end process WR_ADDR;
@@ -409,22 +451,23 @@ begin
    RD_DATA: process(mem_ui_clk)
    begin
       if rising_edge(mem_ui_clk) then
-         if cState = stWaitCen and mem_rd_data_valid = '1' and 
+         if cState = stWaitRd and mem_rd_data_valid = '1' and 
             mem_rd_data_end = '1' then
-            case(ram_a_int(2 downto 0)) is
-               when "000" => 
+            ram_line_o <= mem_rd_data;
+            case(ram_a_int(3 downto 2)) is
+               when "00" => 
                   -- 32-bit
                   ram_dq_o <= mem_rd_data(31 downto 0);
 
-               when "010" => 
-                  -- 16-bit
+               when "01" => 
+                  -- 32-bit
                   ram_dq_o <= mem_rd_data(63 downto 32);
 
-               when "100" => 
-                  -- 16-bit
+               when "10" => 
+                  -- 32-bit
                   ram_dq_o <= mem_rd_data(95 downto 64);
 
-               when "110" => 
+               when "11" => 
                   ram_dq_o <= mem_rd_data(127 downto 96);
 
                when others => null;
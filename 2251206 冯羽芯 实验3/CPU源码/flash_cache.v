@@ -0,0 +1,198 @@
+`timescale 1ns / 1ps
+
+// Flash 就地执行（XIP）读缓存：放在 Wishbone 总线互联矩阵的从设备接口 3 与 flash_rom 之间
+// 直接映射，每行 16 字节（4 个字），缺失时用 flash_rom 的连续读一次取回一整行
+// 命中时下一个周期就给出应答，代码和只读数据预热之后可以接近片上存储器的速度
+//
+// 失效控制：
+//   写 0x3F000000（地址的 [27:24] 为 4'hF）使整个缓存失效，不访问 Flash
+//   其余写操作照常转发给 flash_rom，同时使整个缓存失效
+module flash_cache #(
+    parameter LINE_NUM_LOG2 = 6              // 缓存行数取对数，默认 64 行，共 1KB
+)(
+    // Wishbone 总线接口，连接到总线互联矩阵
+    input wire        wb_clk_i,        // Wishbone 时钟
+    input wire        wb_rst_i,        // Wishbone 复位
+    input wire        wb_cyc_i,        // Wishbone 总线周期有效
+    input wire        wb_stb_i,        // Wishbone 选通信号
+    input wire        wb_we_i,         // Wishbone 写使能
+    input wire [3:0]  wb_sel_i,        // Wishbone 字节选择
+    input wire [31:0] wb_adr_i,        // Wishbone 地址
+    input wire [31:0] wb_dat_i,        // Wishbone 写数据
+    output reg [31:0] wb_dat_o,        // Wishbone 读数据
+    output reg        wb_ack_o,        // Wishbone 应答
+
+    // 连接 flash_rom 的 Wishbone 主设备接口
+    output reg        fl_cyc_o,
+    output reg        fl_stb_o,
+    output reg        fl_we_o,
+    output reg [3:0]  fl_sel_o,
+    output reg [23:0] fl_adr_o,
+    output reg [31:0] fl_dat_o,
+    input wire [31:0] fl_dat_i,
+    input wire        fl_ack_i
+    );
+
+// 状态机状态定义
+parameter C_IDLE  = 2'b00;   // 等待访问
+parameter C_FILL  = 2'b01;   // 缺失，依次读回一行中的 4 个字
+parameter C_WRITE = 2'b10;   // 把写操作转发给 flash_rom
+parameter C_GAP   = 2'b11;   // 两次 flash_rom 访问之间撤销总线周期两个周期
+
+parameter TAG_WIDTH = 24 - 4 - LINE_NUM_LOG2;
+
+reg [1:0]  state;
+reg [1:0]  word_cnt;                                // 行填充时正在读取的字
+reg        gap_to_fill;                             // C_GAP 之后是否继续填充
+reg        gap_wait;                                // C_GAP 已经等待了一个周期
+reg [23:0] req_adr;                                 // 正在处理的访问的地址
+reg        abort;                                   // 主设备已经撤销了总线周期
+
+// 处理器的流水线被清除时，wishbone_bus_if 会在访问中途撤销总线周期，之后总线上可能
+// 是另一次访问，所以填充时使用锁存的地址，完成时只对仍在等待的同一次访问给出应答
+
+reg [31:0]            line_data[0:(1 << (LINE_NUM_LOG2 + 2)) - 1];  // 缓存的数据
+reg [TAG_WIDTH - 1:0] line_tag[0:(1 << LINE_NUM_LOG2) - 1];         // 每行的标签
+reg [(1 << LINE_NUM_LOG2) - 1:0] line_valid;                        // 每行的有效位
+
+wire [LINE_NUM_LOG2 - 1:0] index = wb_adr_i[LINE_NUM_LOG2 + 3:4];
+wire [TAG_WIDTH - 1:0]     tag   = wb_adr_i[23:LINE_NUM_LOG2 + 4];
+wire                       req   = wb_cyc_i & wb_stb_i & ~wb_ack_o;
+wire                       ctrl  = (wb_adr_i[27:24] == 4'hF);       // 失效控制地址
+wire                       hit   = line_valid[index] && (line_tag[index] == tag);
+wire                       fill_we = (state == C_FILL) && fl_ack_i;
+wire [LINE_NUM_LOG2 - 1:0] fill_index = req_adr[LINE_NUM_LOG2 + 3:4];
+wire [TAG_WIDTH - 1:0]     fill_tag   = req_adr[23:LINE_NUM_LOG2 + 4];
+wire                       same_req   = wb_cyc_i & wb_stb_i & ~abort & (wb_adr_i[23:0] == req_adr);
+
+// 数据和标签存储器，不带复位，综合为分布式 RAM
+always @ (posedge wb_clk_i) begin
+    if(fill_we) begin
+        line_data[{fill_index, word_cnt}] <= fl_dat_i;
+        if(word_cnt == 2'b11) begin
+            line_tag[fill_index] <= fill_tag;
+        end
+    end
+end
+
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        state       <= C_IDLE;
+        word_cnt    <= 2'b00;
+        gap_to_fill <= 1'b0;
+        gap_wait    <= 1'b0;
+        req_adr     <= 24'h000000;
+        abort       <= 1'b0;
+        line_valid  <= {(1 << LINE_NUM_LOG2){1'b0}};
+        wb_ack_o    <= 1'b0;
+        wb_dat_o    <= 32'h00000000;
+        fl_cyc_o    <= 1'b0;
+        fl_stb_o    <= 1'b0;
+        fl_we_o     <= 1'b0;
+        fl_sel_o    <= 4'b0000;
+        fl_adr_o    <= 24'h000000;
+        fl_dat_o    <= 32'h00000000;
+    end
+    else begin
+        wb_ack_o <= 1'b0;               // 应答只保持一个周期
+        case(state)
+        C_IDLE:
+        begin
+            if(req) begin
+                req_adr <= wb_adr_i[23:0];
+                abort   <= 1'b0;
+                if(wb_we_i) begin
+                    line_valid <= {(1 << LINE_NUM_LOG2){1'b0}};
+                    if(ctrl) begin
+                        wb_ack_o <= 1'b1;        // 只是失效操作，直接应答
+                    end
+                    else begin
+                        fl_cyc_o <= 1'b1;
+                        fl_stb_o <= 1'b1;
+                        fl_we_o  <= 1'b1;
+                        fl_sel_o <= wb_sel_i;
+                        fl_adr_o <= {wb_adr_i[23:2], 2'b00};
+                        fl_dat_o <= wb_dat_i;
+                        state    <= C_WRITE;
+                    end
+                end
+                else if(hit) begin
+                    wb_dat_o <= line_data[{index, wb_adr_i[3:2]}];
+                    wb_ack_o <= 1'b1;
+                end
+                else begin
+                    // 从行首开始按顺序读，相邻的行也能利用 flash_rom 的连续读
+                    fl_cyc_o <= 1'b1;
+                    fl_stb_o <= 1'b1;
+                    fl_we_o  <= 1'b0;
+                    fl_sel_o <= 4'b1111;
+                    fl_adr_o <= {wb_adr_i[23:4], 4'b0000};
+                    word_cnt <= 2'b00;
+                    state    <= C_FILL;
+                end
+            end
+        end
+
+        C_FILL:
+        begin
+            if(~wb_cyc_i) begin
+                abort <= 1'b1;
+            end
+            if(fl_ack_i) begin
+                if(word_cnt == req_adr[3:2]) begin
+                    wb_dat_o <= fl_dat_i;        // 记下本次访问要的字
+                end
+                fl_cyc_o <= 1'b0;
+                fl_stb_o <= 1'b0;
+                if(word_cnt == 2'b11) begin
+                    line_valid[fill_index] <= 1'b1;
+                    wb_ack_o               <= same_req & ~wb_we_i;
+                    state                  <= C_IDLE;
+                end
+                else begin
+                    word_cnt    <= word_cnt + 2'b01;
+                    fl_adr_o    <= fl_adr_o + 24'd4;
+                    gap_to_fill <= 1'b1;
+                    gap_wait    <= 1'b0;
+                    state       <= C_GAP;
+                end
+            end
+        end
+
+        C_WRITE:
+        begin
+            if(~wb_cyc_i) begin
+                abort <= 1'b1;
+            end
+            if(fl_ack_i) begin
+                fl_cyc_o    <= 1'b0;
+                fl_stb_o    <= 1'b0;
+                fl_we_o     <= 1'b0;
+                wb_ack_o    <= same_req & wb_we_i;
+                gap_to_fill <= 1'b0;
+                gap_wait    <= 1'b0;
+                state       <= C_GAP;
+            end
+        end
+
+        // flash_rom 要求每次应答之后撤销总线周期，它的状态机要在 HOLD/IDLE 中
+        // 执行过一次（更新 next_state）之后才能发起下一次访问，所以至少等待两个周期
+        C_GAP:
+        begin
+            if(~gap_wait) begin
+                gap_wait <= 1'b1;
+            end
+            else if(gap_to_fill) begin
+                fl_cyc_o <= 1'b1;
+                fl_stb_o <= 1'b1;
+                state    <= C_FILL;
+            end
+            else begin
+                state    <= C_IDLE;
+            end
+        end
+        endcase
+    end
+end
+
+endmodule
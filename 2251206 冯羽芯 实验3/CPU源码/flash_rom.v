@@ -2,36 +2,37 @@
 
 // main two part: 1.spi flash control 2. wb main bus
 module flash_rom(
-    // Wishbone ߽ӿ
-    input wire wb_clk_i,        // Wishbone ʱ
-    input wire wb_rst_i,        // Wishbone λ
-    input wire wb_cyc_i,        // Wishbone Ч
-    input wire wb_stb_i,        // Wishbone ѡͨź
-    input wire wb_we_i,         // Wishbone дʹ
-    input wire [3:0] wb_sel_i,  // Wishbone ֽѡ
-    input wire [23:0] wb_adr_i, // Wishbone ַ
-    input wire [31:0] wb_dat_i, // Wishbone д
-    output reg [31:0] wb_dat_o, // Wishbone 
-    output reg        wb_ack_o, // Wishbone Ӧ
-
-    input wire flash_continue, // Flash ź
-
-    // SPI Flash ӿ
-    output reg cs_n,   // ƬѡźţЧ
-    input  sdi,        // SPI 루 Flash  FPGA
-    output reg sdo,    // SPI  FPGA  Flash
-    output reg wp_n,   // дЧ
-    output reg hld_n   // źţЧ
+    // Wishbone 总线接口
+    input wire wb_clk_i,        // Wishbone 时钟
+    input wire wb_rst_i,        // Wishbone 复位
+    input wire wb_cyc_i,        // Wishbone 总线周期有效
+    input wire wb_stb_i,        // Wishbone 选通信号
+    input wire wb_we_i,         // Wishbone 写使能
+    input wire [3:0] wb_sel_i,  // Wishbone 字节选择
+    input wire [23:0] wb_adr_i, // Wishbone 地址
+    input wire [31:0] wb_dat_i, // Wishbone 写数据
+    output reg [31:0] wb_dat_o, // Wishbone 读数据
+    output reg        wb_ack_o, // Wishbone 应答
+
+    input wire flash_continue, // Flash 继续操作信号
+
+    // SPI Flash 接口
+    output reg cs_n,   // 片选信号，低有效
+    input  sdi,        // SPI 数据输入（从 Flash 到 FPGA）
+    output reg sdo,    // SPI 数据输出（从 FPGA 到 Flash）
+    output reg wp_n,   // 写保护，低有效
+    output reg hld_n   // 保持信号，低有效
     );
 
 
-// ״̬״̬
+// 状态机状态定义
 parameter IDLE       = 5'b00000;
 parameter START      = 5'b00010;
 parameter INST_OUT   = 5'b00011;
 parameter ADDR1_OUT  = 5'b00100;
 parameter ADDR2_OUT  = 5'b00101;
 parameter ADDR3_OUT  = 5'b00110;
+parameter DUMMY_OUT  = 5'b00001;   // FAST_READ 指令在地址之后的 8 个空时钟
 parameter WRITE_DATA = 5'b00111;
 parameter READ_DATA  = 5'b01000;
 parameter READ_DATA1 = 5'b01001;
@@ -41,139 +42,156 @@ parameter READ_DATA4 = 5'b01100;
 parameter READ_DATA5 = 5'b01101;
 parameter WAITING    = 5'b10000;
 parameter ENDING     = 5'b10001;
+parameter HOLD       = 5'b10010;   // 连续读：片选保持有效，SCK 停止，等待下一个顺序地址
+parameter RESUME     = 5'b10011;   // 连续读：重新开启 SCK，直接接收数据
+parameter CLOSE      = 5'b10100;   // 连续读：地址不连续，拉高片选后重新发送指令
 
 
-// ʼ
+// 初始化计数器
 (* dont_touch = "true" *)reg[4:0] init_count;
 
-// SPI ؼĴ
-(* dont_touch = "true" *)reg         sck;        // SPI ʱ
-(* dont_touch = "true" *)reg  [4:0]  state;      // ǰ״̬
-reg  [4:0]  next_state;                         // һ״̬
-
-(* dont_touch = "true" *)reg  [7:0]   instruction;   // SPI ָ
-(* dont_touch = "true" *)reg  [7:0]   datain_shift;  // SPI λĴ
-(* dont_touch = "true" *)reg  [7:0]   datain;        // SPI 
-(* dont_touch = "true" *)reg  [7:0]   dataout;       // SPI 
-(* dont_touch = "true" *)reg          sck_en;        // SPI ʱʹ
-(* dont_touch = "true" *)reg  [2:0]   sck_en_d;      // SPI ʱʹӳ
-(* dont_touch = "true" *)reg [10:0]   read_count;    // 
-reg  [2:0]  cs_n_d;                                 // Ƭѡźӳ
-
-reg         temp;                                   // ʱ
-(* dont_touch = "true" *)reg  [3:0]  sdo_count;     // SPI 
-reg  [15:0] page_count;                             // ҳ
-reg  [7:0]  wait_count;                             // ȴ
-(* dont_touch = "true" *)reg  [23:0] addr;          // 24 λַ
-reg         wrh_rdl;                                // д/־1 Ϊд0 Ϊ
-reg         addr_req;                               // ַ־
-reg  [15:0] wr_cnt;                                 // дֽ
-reg  [15:0] rd_cnt;                                 // ֽ
-(* dont_touch = "true" *)reg [31:0] read_data;      // 
-
-
-// ״̬Wishbone ӿ SPI Flash
+// SPI 控制相关寄存器
+(* dont_touch = "true" *)reg         sck;        // SPI 时钟
+(* dont_touch = "true" *)reg  [4:0]  state;      // 当前状态
+reg  [4:0]  next_state;                         // 下一个状态
+
+(* dont_touch = "true" *)reg  [7:0]   instruction;   // SPI 指令
+(* dont_touch = "true" *)reg  [7:0]   datain_shift;  // SPI 输入移位寄存器
+(* dont_touch = "true" *)reg  [7:0]   datain;        // SPI 输入数据
+(* dont_touch = "true" *)reg  [7:0]   dataout;       // SPI 输出数据
+(* dont_touch = "true" *)reg          sck_en;        // SPI 时钟使能
+(* dont_touch = "true" *)reg  [2:0]   sck_en_d;      // SPI 时钟使能延迟
+(* dont_touch = "true" *)reg [10:0]   read_count;    // 读计数器
+reg  [2:0]  cs_n_d;                                 // 片选信号延迟
+
+reg         temp;                                   // 临时变量
+(* dont_touch = "true" *)reg  [3:0]  sdo_count;     // SPI 输出计数
+reg  [15:0] page_count;                             // 页计数
+reg  [7:0]  wait_count;                             // 等待计数
+(* dont_touch = "true" *)reg  [23:0] addr;          // 24 位地址
+reg         wrh_rdl;                                // 写/读标志，1 为写，0 为读
+reg         addr_req;                               // 地址请求标志
+reg  [15:0] wr_cnt;                                 // 写字节数
+reg  [15:0] rd_cnt;                                 // 读字节数
+(* dont_touch = "true" *)reg [31:0] read_data;      // 读出的数据
+reg         stream_valid;                           // 片选仍有效，Flash 停在下一个字的开头
+reg  [23:0] stream_addr;                            // 连续读时下一个字的地址
+
+
+// 状态机：Wishbone 接口与 SPI Flash控制
 always @ (posedge wb_clk_i or posedge wb_rst_i) begin
     if(wb_rst_i) begin
-        // 첽λйؼĴʼ
-        state      <= IDLE;        // ״̬ص IDLE ״̬
-        read_count <= 11'd0;       // 
-        wb_ack_o   <= 1'b0;        // Wishbone Ӧź
-        init_count <= 5'd2;        // ʼ
+        // 异步复位：所有关键寄存器初始化
+        state      <= IDLE;        // 状态机回到 IDLE 空闲状态
+        read_count <= 11'd0;       // 读计数清零
+        wb_ack_o   <= 1'b0;        // Wishbone 应答信号清零
+        init_count <= 5'd2;        // 初始化计数器
+    end
+    else if(state == CLOSE) begin
+        // 片选拉高的 8 个周期不受总线周期影响，结束后回到 IDLE
+        state    <= (wait_count == 8'd8) ? IDLE : CLOSE;
+        wb_ack_o <= 1'b0;
     end
     else if(wb_cyc_i & wb_stb_i) begin
-        // Wishbone Чʱ״̬лһ״̬
+        // Wishbone 总线有效时，状态机切换到下一个状态
         state <= next_state;
-        // ǰ ENDING ״̬һδӦ
+        // 如果当前处于 ENDING 状态且还未应答
         if(state == ENDING && !wb_ack_o) begin
             if(init_count > 5'd0) begin
-                // ӳһʱص IDLEֹ߳ͻ
+                // 延迟一段时间后回到 IDLE，防止总线冲突
                 init_count <= init_count - 5'd1;
                 state      <= IDLE;
             end
             else 
-                wb_ack_o   <= 1'b1; // ոӦź
+                wb_ack_o   <= 1'b1; // 最终给出应答信号
         end
     end
     else begin
-        // Wishbone Чʱ״̬ص IDLEӦź
-        state    <= IDLE;
+        // Wishbone 无效时，状态机回到 IDLE，应答信号清零
+        // 处于连续读时回到 HOLD，片选保持有效，等待下一次访问
+        // 一个字还没有传输完就撤销了总线周期，Flash 停在字的中间，经 CLOSE 结束这次读
+        if(state == IDLE || state == HOLD || state == ENDING)
+            state <= (stream_valid) ? HOLD : IDLE;
+        else
+            state <= CLOSE;
         wb_ack_o <= 1'b0;
     end
 end
 
-// SPI źĬֵ
+// SPI 控制信号默认值设置
 always @ (posedge wb_clk_i) begin
-    // ÿʱڶдͱźߣʹܣ
+    // 每个时钟周期都将写保护和保持信号拉高（不使能）
     wp_n  <= 1'b1;
     hld_n <= 1'b1;
 end
 
 
-// ״̬̼״̬¼Ĵֵ
+// 状态机主流程及各状态下寄存器赋值
 always @ (posedge wb_clk_i or posedge wb_rst_i) begin
 	if(wb_rst_i) begin
-		// 첽λ SPI ؼĴʼ
-        next_state  <= IDLE;      // һ״̬Ϊ IDLE
-        sck_en      <= 1'b0;      // SPI ʱӽֹ
-        cs_n_d[0]   <= 1'b1;      // ƬѡߣѡУ
-        dataout     <= 8'd0;      // SPI 
-        sdo_count   <= 4'd0;      // SPI 
-        sdo         <= 1'b0;      // SPI 
-        datain      <= 8'd0;      // SPI 
-        addr        <=24'd0;      // ַ
-        datain_shift<=8'd0;       // λĴ
-        temp        <= 1'b0;      // ʱ
-        page_count  <= 16'd0;     // ҳ
-        wait_count  <= 8'd0;      // ȴ
-        read_data   <=32'd0;      // ݼĴ
+		// 异步复位：所有 SPI 相关寄存器初始化
+        next_state  <= IDLE;      // 下一个状态为 IDLE
+        sck_en      <= 1'b0;      // SPI 时钟禁止
+        cs_n_d[0]   <= 1'b1;      // 片选拉高（不选中）
+        dataout     <= 8'd0;      // SPI 输出数据清零
+        sdo_count   <= 4'd0;      // SPI 输出计数清零
+        sdo         <= 1'b0;      // SPI 输出数据线清零
+        datain      <= 8'd0;      // SPI 输入数据清零
+        addr        <=24'd0;      // 地址清零
+        datain_shift<=8'd0;       // 输入移位寄存器清零
+        temp        <= 1'b0;      // 临时变量清零
+        page_count  <= 16'd0;     // 页计数清零
+        wait_count  <= 8'd0;      // 等待计数清零
+        read_data   <=32'd0;      // 读数据寄存器清零
+        stream_valid<= 1'b0;      // 没有处于连续读
+        stream_addr <=24'd0;
         
 	end
 	else begin
 		case(state)
-		// ״̬ȴ flash_continue źߺ START
+		// 空闲状态，等待 flash_continue 信号拉高后进入 START
 		IDLE: 
 		begin
-            wait_count <= 8'd0; // ȴ
+            wait_count <= 8'd0; // 等待计数清零
             if(flash_continue==1'd1)
-                next_state<=START; // ⵽ flash_continue źţ׼ SPI
-            // 򱣳 IDLE
+                next_state<=START; // 检测到 flash_continue 信号，准备启动 SPI
+            // 否则保持在 IDLE
         end
 		
 		START:
-		// ״̬׼ SPI ͨţ CSصַ
+		// 启动状态，准备 SPI 通信，拉低 CS，加载地址
 		begin
-            addr       <= wb_adr_i;      //  Wishbone  24 λַ
-            sck_en     <= 1'b1;      // ʹ SPI ʱ
-            cs_n_d[0]  <= 1'b0;  // Ƭѡѡ Flash
-            next_state <= INST_OUT; // ָ״̬
-            read_count <= read_count + 11'd1; //  +1
+            addr       <= wb_adr_i;      // 保存 Wishbone 传入的 24 位地址
+            sck_en     <= 1'b1;      // 使能 SPI 时钟
+            cs_n_d[0]  <= 1'b0;  // 拉低片选，选中 Flash
+            next_state <= INST_OUT; // 进入指令发送状态
+            read_count <= read_count + 11'd1; // 读计数 +1
         end
 
-		// ָ״̬ 8 λ SPI ָλƳ
+		// 指令发送状态，将 8 位 SPI 指令逐位移出
         INST_OUT:
         begin
-            // sdo_count == 1 ʱָλĴ
+            // sdo_count == 1 时，加载指令到移位寄存器
             if(sdo_count == 4'd1) begin
                 {sdo, dataout[6:0]} <= instruction;
             end
-            // ڣλ
+            // 其余奇数周期，移位输出
             else if(sdo_count[0]) begin
                 {sdo, dataout[6:0]} <= {dataout[6:0], 1'b0};
             end
 
-            //  16 ʱӣ8 λ +8 ʱӣ
+            // 发送满 16 个时钟（8 位数据 +8 个空时钟），结束
             if(sdo_count != 4'd15) begin
                 sdo_count <= sdo_count + 4'd1;
             end
             else begin
                 sdo_count  <= 4'd0;
-                // жǷҪֱַӽݽ׶
+                // 判断是否需要发地址，还是直接进入数据阶段
                 next_state <= (addr_req) ?  ADDR1_OUT : ((wrh_rdl) ? ((wr_cnt==16'd0) ? ENDING : WRITE_DATA) : ((rd_cnt==16'd0) ? ENDING : READ_DATA1));
             end
         end
 
-		// ͵ַ 8 λ
+		// 发送地址高 8 位
         ADDR1_OUT:
         begin
             if(sdo_count == 4'd1) begin
@@ -188,11 +206,11 @@ always @ (posedge wb_clk_i or posedge wb_rst_i) begin
             end
             else begin
                 sdo_count  <= 4'd0;
-                next_state <= ADDR2_OUT; //  8 λַ
+                next_state <= ADDR2_OUT; // 进入中 8 位地址发送
             end
         end
 
-		// ͵ַ 8 λ
+		// 发送地址中 8 位
         ADDR2_OUT:
         begin
             if(sdo_count == 4'd1) begin
@@ -207,11 +225,11 @@ always @ (posedge wb_clk_i or posedge wb_rst_i) begin
             end
             else begin
                 sdo_count  <= 4'd0;
-                next_state <= ADDR3_OUT; //  8 λַ
+                next_state <= ADDR3_OUT; // 进入低 8 位地址发送
             end
         end
 
-		// ͵ַ 8 λ
+		// 发送地址低 8 位
         ADDR3_OUT:
         begin
             if(sdo_count == 4'd1) begin
@@ -226,13 +244,33 @@ always @ (posedge wb_clk_i or posedge wb_rst_i) begin
             end
             else begin
                 sdo_count  <= 4'd0;
-                // ждǶ
-                next_state <= (wrh_rdl) ? ((wr_cnt==16'd0) ? ENDING : WRITE_DATA) : ((rd_cnt==16'd0) ? ENDING : READ_DATA1);
-                page_count <= 16'd0; // ҳ
+                // 判断是写还是读，FAST_READ 还要先发送一个空字节
+                next_state <= (wrh_rdl) ? ((wr_cnt==16'd0) ? ENDING : WRITE_DATA) :
+                              ((rd_cnt==16'd0) ? ENDING : ((instruction == 8'h0B) ? DUMMY_OUT : READ_DATA1));
+                page_count <= 16'd0; // 页计数清零
+            end
+        end
+
+		// FAST_READ 的空字节，输出 8 个时钟，Flash 在此期间准备数据
+        DUMMY_OUT:
+        begin
+            if(sdo_count == 4'd1) begin
+                {sdo, dataout[6:0]} <= 8'h00;
+            end
+            else if(sdo_count[0]) begin
+                {sdo, dataout[6:0]} <= {dataout[6:0], 1'b0};
+            end
+
+            if(sdo_count != 4'd15) begin
+                sdo_count <= sdo_count + 4'd1;
+            end
+            else begin
+                sdo_count  <= 4'd0;
+                next_state <= READ_DATA1;
             end
         end
 
-		// д״̬Ϊ 0x5A
+		// 写数据状态（本例为测试数据 0x5A）
         WRITE_DATA:
         begin
             if(sdo_count == 4'd1) begin
@@ -248,19 +286,19 @@ always @ (posedge wb_clk_i or posedge wb_rst_i) begin
             else begin
                 page_count <= page_count + 16'd1;
                 sdo_count  <= 4'd0;
-                // жǷд
+                // 判断是否写完所有数据
                 next_state <= (page_count < (wr_cnt - 16'd1)) ? WRITE_DATA : ENDING;
             end
         end
 
-		// ݵ 1 ֽڣֽڣλ
+		// 读数据第 1 字节（虚拟字节），移位接收
         READ_DATA1:
         begin
-            // żλ sdi
+            // 偶数周期移位接收 sdi
             if(~sdo_count[0]) begin
                 datain_shift <= {datain_shift[6:0], sdi};
             end
-            // sdo_count == 1 ʱ 1 ֽ
+            // sdo_count == 1 时，锁存第 1 字节
             if(sdo_count == 4'd1) begin
                 datain <= {datain_shift, sdi};
             end
@@ -271,11 +309,11 @@ always @ (posedge wb_clk_i or posedge wb_rst_i) begin
             else begin
                 page_count <= page_count + 16'd1;
                 sdo_count  <= 4'd0;
-                next_state <= READ_DATA2; //  2 ֽڽ
+                next_state <= READ_DATA2; // 进入第 2 字节接收
             end
         end
 
-        READ_DATA2: // ֻµ 2 Եǰڴ SPI ֽģ 6 ǡ¾ɡ
+        READ_DATA2: // 只有最新的 2 个比特是来自当前正在传输的 SPI 字节流的，其余 6 个比特是“陈旧”的
         begin
             if(~sdo_count[0]) begin
                 datain_shift <= {datain_shift[6:0], sdi};
@@ -291,11 +329,11 @@ always @ (posedge wb_clk_i or posedge wb_rst_i) begin
             else begin
                 page_count <= page_count + 16'd1;
                 sdo_count  <= 4'd0;
-                next_state <= READ_DATA3; //  3 ֽڽ
+                next_state <= READ_DATA3; // 进入第 3 字节接收
             end
         end
 
-		// ݵ 3 ֽڣ read_data[23:16]
+		// 读数据第 3 字节，存入 read_data[23:16]
         READ_DATA3:
         begin
             if(~sdo_count[0]) begin
@@ -312,11 +350,11 @@ always @ (posedge wb_clk_i or posedge wb_rst_i) begin
             else begin
                 page_count <= page_count + 16'd1;
                 sdo_count  <= 4'd0;
-                next_state <=READ_DATA4; //  4 ֽڽ
+                next_state <=READ_DATA4; // 进入第 4 字节接收
             end
         end
 
-		// ݵ 4 ֽڣ read_data[15:8]
+		// 读数据第 4 字节，存入 read_data[15:8]
         READ_DATA4:
         begin
             if(~sdo_count[0]) begin
@@ -333,11 +371,11 @@ always @ (posedge wb_clk_i or posedge wb_rst_i) begin
             else begin
                 page_count <= page_count + 16'd1;
                 sdo_count  <= 4'd0;
-                next_state <=READ_DATA5; //  5 ֽڽ
+                next_state <=READ_DATA5; // 进入第 5 字节接收
             end
         end
 
-		// ݵ 5 ֽڣ read_data[7:0]
+		// 读数据第 5 字节，存入 read_data[7:0]
         READ_DATA5:
         begin
             if(~sdo_count[0]) begin
@@ -346,6 +384,12 @@ always @ (posedge wb_clk_i or posedge wb_rst_i) begin
             if(sdo_count == 4'd1) begin
                 read_data[7:0] <= {datain_shift, sdi};
                 datain<= {datain_shift, sdi};
+                // 初始化重试结束后进入连续读：第 4 字节的时钟刚好发完，
+                // 在下一个上升沿之前停住 SCK，Flash 停在下一个字的第一个比特
+                if(init_count == 5'd0) begin
+                    sck_en     <= 1'b0;
+                    next_state <= WAITING;
+                end
             end
 
             if(sdo_count != 4'd15) begin
@@ -354,58 +398,105 @@ always @ (posedge wb_clk_i or posedge wb_rst_i) begin
             else begin
                 page_count <= page_count + 16'd1;
                 sdo_count  <= 4'd0;
-                next_state <=WAITING; // ݽϣȴ
+                next_state <=WAITING; // 数据接收完毕，进入等待
             end
         end
 
-		// ȴ״̬ر SCK  CS׼
+		// 等待状态，关闭 SCK 和 CS，准备结束
         WAITING:
         begin
-            sck_en <= 1'b0;      // ֹ SPI ʱ
-            cs_n_d[0] <= 1'b1;   // Ƭѡͷ Flash
-            sdo_count <= 4'd0;   // 
-            next_state<=ENDING;  // ״̬
+            sck_en <= 1'b0;      // 禁止 SPI 时钟
+            sdo_count <= 4'd0;   // 输出计数清零
+            if(init_count == 5'd0) begin
+                // 连续读：片选保持有效，记录下一个顺序地址
+                stream_valid <= 1'b1;
+                stream_addr  <= addr + 24'd4;
+            end
+            else begin
+                cs_n_d[0] <= 1'b1;   // 拉高片选，释放 Flash
+            end
+            next_state<=ENDING;  // 进入结束状态
         end
 
-		// ״̬ȴ Wishbone Ӧ
+		// 结束状态，等待 Wishbone 应答
         ENDING:
         begin
-            // գȴⲿ always 鴦Ӧź
+            // 空，等待外部 always 块处理应答信号
+        end
+
+		// 连续读的等待状态，SCK 停止，片选保持有效
+        HOLD:
+        begin
+            sdo_count  <= 4'd0;
+            wait_count <= 8'd0;
+            if(wb_cyc_i & wb_stb_i) begin
+                if(~wb_we_i && (wb_adr_i == stream_addr)) begin
+                    // 顺序地址：不用再发送指令和地址，直接继续接收数据
+                    next_state <= (flash_continue == 1'd1) ? RESUME : HOLD;
+                end
+                else begin
+                    next_state <= CLOSE;
+                end
+            end
+            else begin
+                next_state <= HOLD;
+            end
+        end
+
+		// 与 START 相同的时序重新开启 SCK，保证时钟与数据接收的相位不变
+        RESUME:
+        begin
+            addr       <= wb_adr_i;
+            sck_en     <= 1'b1;
+            next_state <= READ_DATA1;
+        end
+
+		// 结束连续读或者中途撤销的读，片选拉高至少 8 个周期后再从 IDLE 重新开始
+        CLOSE:
+        begin
+            cs_n_d[0]    <= 1'b1;
+            sck_en       <= 1'b0;      // 传输中途撤销时 SCK 还在翻转
+            sdo_count    <= 4'd0;
+            stream_valid <= 1'b0;
+            wait_count   <= wait_count + 8'd1;
+            if(wait_count == 8'd7) begin
+                next_state <= IDLE;
+            end
         end
 		endcase
 	end
 end
 
-// SCK  SPI ʱź
+// SCK 生成器，产生 SPI 时钟信号
 always @ (posedge wb_clk_i) begin
-    // sck_en_d  sck_en Ĵӳ٣ͬͱؼ
+    // sck_en_d 是 sck_en 的打拍延迟，用于同步和边沿检测
     sck_en_d <= {sck_en_d[1:0], sck_en};
 end
 
 always @ (posedge wb_clk_i or posedge wb_rst_i) begin
     if(wb_rst_i) begin
-        sck <= 1'b0; // λʱ SPI ʱ
+        sck <= 1'b0; // 复位时 SPI 时钟拉低
     end
-    // sck_en_d[2] & sck_en Ϊʱת sckʵ SPI ʱ
+    // sck_en_d[2] & sck_en 为真时，翻转 sck，实现 SPI 时钟
     else if(sck_en_d[2] & sck_en) begin
         sck <= ~sck;
     end
     else begin
-        sck <= 1'b0; // ֵ͵ƽ
+        sck <= 1'b0; // 其他情况保持低电平
     end
 end
 
-// Ƭѡźӳٴ֤ SPI ʱȶ
+// 片选信号延迟处理，保证 SPI 时序稳定
 always @ (posedge wb_clk_i or posedge wb_rst_i) begin
     if(wb_rst_i) begin
-        {cs_n, cs_n_d[2:1]} <= 3'h7; // λʱƬѡߣѡУ
+        {cs_n, cs_n_d[2:1]} <= 3'h7; // 复位时片选拉高（不选中）
     end
     else begin
-        {cs_n, cs_n_d[2:1]} <= cs_n_d; // Ƭѡźλӳ
+        {cs_n, cs_n_d[2:1]} <= cs_n_d; // 片选信号移位，延迟输出
     end
 end
 
-// STARTUPE2 ԭڽûʱӣsck SPI Flash  SCK 
+// STARTUPE2 原语，用于将用户时钟（sck）输出到 SPI Flash 的 SCK 引脚
 STARTUPE2
 #(
 .PROG_USR("FALSE"),
@@ -413,33 +504,33 @@ STARTUPE2
 )
 STARTUPE2_inst
 (
-  .CFGCLK     (),           // δ
-  .CFGMCLK    (),           // δ
-  .EOS        (),           // δ
-  .PREQ       (),           // δ
-  .CLK        (1'b0),       // δ
-  .GSR        (1'b0),       // δ
-  .GTS        (1'b0),       // δ
-  .KEYCLEARB  (1'b0),       // δ
-  .PACK       (1'b0),       // δ
-  .USRCCLKO   (sck),        // û SPI ʱ
-  .USRCCLKTS  (1'b0),       // 0 ʹ CCLK 
+  .CFGCLK     (),           // 未用
+  .CFGMCLK    (),           // 未用
+  .EOS        (),           // 未用
+  .PREQ       (),           // 未用
+  .CLK        (1'b0),       // 未用
+  .GSR        (1'b0),       // 未用
+  .GTS        (1'b0),       // 未用
+  .KEYCLEARB  (1'b0),       // 未用
+  .PACK       (1'b0),       // 未用
+  .USRCCLKO   (sck),        // 用户 SPI 时钟输出
+  .USRCCLKTS  (1'b0),       // 0 使能 CCLK 输出
   .USRDONEO   (1'b1),       // 1
   .USRDONETS  (1'b1)        // 1
 );
 
-// ָãΪ̶ָ
+// 指令与操作参数设置（本例为固定读指令）
 always @ (posedge wb_clk_i) begin
-    instruction <= 8'h03;    // ָ0x03
-    wrh_rdl     <= 1'b0;     // 
-    addr_req    <= 1'b1;     // Ҫ͵ַ
-    wr_cnt      <= 16'd0;    // дֽΪ0
-    rd_cnt      <= 16'd4;    // 4ֽ
+    instruction <= 8'h0B;    // 快速读指令 FAST_READ（0x0B），地址之后有 1 个空字节
+    wrh_rdl     <= 1'b0;     // 读操作
+    addr_req    <= 1'b1;     // 需要发送地址
+    wr_cnt      <= 16'd0;    // 写字节数为0
+    rd_cnt      <= 16'd4;    // 读4字节
 end
 
-// Wishbone 
+// Wishbone 读数据输出
 always @ (posedge wb_clk_i) begin
-    wb_dat_o <= read_data;   // ȡ Wishbone 
+    wb_dat_o <= read_data;   // 将读取到的数据输出到 Wishbone 总线
 end
  
 endmodule
\ No newline at end of file
@@ -99,12 +99,12 @@
 // required, use several instances of GPIO IP core.
 //
 // Default is 16.
-// IO ӿڵõķΧ 1-32Ĭ 31˴Ϊ 32 
+// IO 接口的数量，可以配置的范围是 1-32，默认是 31，此处改为 32 
 `define GPIO_IOS 32
 
 //depending on number of GPIO_IOS, define this...
 // for example: if there is 26 GPIO_IOS, define GPIO_LINES26
-//  IO ӿҪӦĬ 31˴ҲΪ 32
+// 与 IO 接口数量要对应，默认是 31，此处也改为 32
 
 `define GPIO_LINES32
 
@@ -145,7 +145,7 @@
 // RGPIO_AUX register will be removed
 //
 // Defined by default.
-// ĺ궨ע͵ʾûиӿڣҲûб 13-2 е aux_i ӿ
+// 将下面的宏定义注释掉，表示没有复用输入接口，也就是没有表 13-2 中的 aux_i 接口
 //`define GPIO_AUX_IMPLEMENT
 
 //
@@ -154,8 +154,8 @@
 // if disabled defines GPIO_NO_NEGEDGE_FLOPS, GPIO_NO_CLKPAD_LOGIC will have no effect.
 //
 // Defined by default.
-// С SOPC УGPIO ģʱӲõ Wishbone ߵʱӣԽĺ궨ע͵
-// ʾûⲿʱӿڣҲû clk_pad_i ӿ 
+// 在小型 SOPC 中，GPIO 模块的时钟采用的是 Wishbone 总线的时钟，所以将下面的宏定义注释掉，
+// 表示没有外部时钟输入接口，也就是没有 clk_pad_i 接口 
 //`define GPIO_CLKPAD
 
 //
@@ -187,6 +187,17 @@
 //
 `define GPIO_SYNC_IN_WB
 
+//
+// Debounce the synchronized inputs before RGPIO_IN and the interrupt logic.
+// 板上的拨动开关和按键在动作时会抖动几毫秒，边沿中断会因此触发多次。定义下面的宏后，
+// 输入每 2^GPIO_DEBOUNCE_TICK_W 个周期采样一次，连续 4 次采样（加上当前输入）都相同
+// 才改变，100MHz 时约 8~10ms。GPIO_DEBOUNCE_MASK 中为 0 的输入不消抖，例如 
+// sdram_init_done
+//
+`define GPIO_DEBOUNCE
+`define GPIO_DEBOUNCE_TICK_W  18
+`define GPIO_DEBOUNCE_MASK    32'h0000ffff
+
 //
 // Add synchronization flops to external clock input line. Gpio will have just one clock domain, 
 // everithing will be synchronized to wishbone clock. External clock muas be at least 2-3x slower 
@@ -296,6 +307,13 @@
 `define GPIO_RGPIO_CTRL		4'h6	// Address 0x18
 `define GPIO_RGPIO_INTS		4'h7	// Address 0x1c
 
+// RGPIO_OUT 的置位、清零、取反别名：写入值中为 1 的位把 RGPIO_OUT 的对应位置 1、清 0 
+// 或取反，为 0 的位不变，读出的是 RGPIO_OUT。多个任务各自修改 LED、数码管的不同字段时 
+// 只需一次写操作，不用先读再写，也不用关中断。按字写入，忽略字节选择信号 
+`define GPIO_RGPIO_OUT_SET	4'ha	// Address 0x28
+`define GPIO_RGPIO_OUT_CLR	4'hb	// Address 0x2c
+`define GPIO_RGPIO_OUT_TGL	4'hc	// Address 0x30
+
 `ifdef GPIO_CLKPAD
 `define GPIO_RGPIO_ECLK   4'h8  // Address 0x20
 `define GPIO_RGPIO_NEC    4'h9  // Address 0x24
@@ -265,6 +265,7 @@ reg  [gw-1:0]  sync      ,
 `else 
 wire [gw-1:0]  ext_pad_s ;
 `endif
+wire [gw-1:0]  ext_pad_f ; // synchronized and debounced inputs
 
 
 
@@ -272,6 +273,9 @@ wire [gw-1:0]  ext_pad_s ;
 // Internal wires & regs
 //
 wire            rgpio_out_sel;  // RGPIO_OUT select
+wire            rgpio_out_set_sel; // RGPIO_OUT_SET select
+wire            rgpio_out_clr_sel; // RGPIO_OUT_CLR select
+wire            rgpio_out_tgl_sel; // RGPIO_OUT_TGL select
 wire            rgpio_oe_sel; // RGPIO_OE select
 wire            rgpio_inte_sel; // RGPIO_INTE select
 wire            rgpio_ptrig_sel;// RGPIO_PTRIG select
@@ -336,6 +340,16 @@ always @(posedge wb_clk_i or posedge wb_rst_i)
 assign wb_ack_o = wb_ack;
 `endif
 
+//
+// Writes to the RGPIO_OUT aliases are not idempotent (toggle), so with a
+// registered ack only the first cycle of an access is taken as the write
+//
+`ifdef GPIO_REGISTERED_WB_OUTPUTS
+wire            alias_we = wb_we_i & ~wb_ack_o;
+`else
+wire            alias_we = wb_we_i;
+`endif
+
 //
 // WB Error
 //
@@ -382,6 +396,15 @@ assign full_decoding = 1'b1;
 `ifdef GPIO_RGPIO_OUT
 assign rgpio_out_sel = wb_cyc_i & wb_stb_i & (wb_adr_i[`GPIO_OFS_BITS] == `GPIO_RGPIO_OUT) & full_decoding;
 `endif
+`ifdef GPIO_RGPIO_OUT_SET
+assign rgpio_out_set_sel = wb_cyc_i & wb_stb_i & (wb_adr_i[`GPIO_OFS_BITS] == `GPIO_RGPIO_OUT_SET) & full_decoding;
+`endif
+`ifdef GPIO_RGPIO_OUT_CLR
+assign rgpio_out_clr_sel = wb_cyc_i & wb_stb_i & (wb_adr_i[`GPIO_OFS_BITS] == `GPIO_RGPIO_OUT_CLR) & full_decoding;
+`endif
+`ifdef GPIO_RGPIO_OUT_TGL
+assign rgpio_out_tgl_sel = wb_cyc_i & wb_stb_i & (wb_adr_i[`GPIO_OFS_BITS] == `GPIO_RGPIO_OUT_TGL) & full_decoding;
+`endif
 `ifdef GPIO_RGPIO_OE
 assign rgpio_oe_sel = wb_cyc_i & wb_stb_i & (wb_adr_i[`GPIO_OFS_BITS] == `GPIO_RGPIO_OE) & full_decoding;
 `endif
@@ -465,6 +488,21 @@ always @(posedge wb_clk_i or posedge wb_rst_i)
        rgpio_out [gw-1:0] <= #1 wb_dat_i [gw-1:0] ;
 `endif
    end
+//
+// Set, clear and toggle aliases of RGPIO_OUT, whole word only
+//
+`ifdef GPIO_RGPIO_OUT_SET
+	else if (rgpio_out_set_sel && alias_we)
+		rgpio_out <= #1 rgpio_out | wb_dat_i[gw-1:0];
+`endif
+`ifdef GPIO_RGPIO_OUT_CLR
+	else if (rgpio_out_clr_sel && alias_we)
+		rgpio_out <= #1 rgpio_out & ~wb_dat_i[gw-1:0];
+`endif
+`ifdef GPIO_RGPIO_OUT_TGL
+	else if (rgpio_out_tgl_sel && alias_we)
+		rgpio_out <= #1 rgpio_out ^ wb_dat_i[gw-1:0];
+`endif
 
 `else
 assign rgpio_out = `GPIO_DEF_RGPIO_OUT;	// RGPIO_OUT = 0x0
@@ -773,6 +811,42 @@ always @(posedge wb_clk_i or posedge wb_rst_i)
 `else 
 assign  ext_pad_s = ext_pad_i;
 `endif // GPIO_SYNC_IN_WB
+
+//
+// debounce inputs: a line follows its input once the last three samples,
+// taken every 2^GPIO_DEBOUNCE_TICK_W clocks, and the input itself agree
+//
+`ifdef GPIO_DEBOUNCE
+reg  [`GPIO_DEBOUNCE_TICK_W-1:0] db_div ;
+reg  [gw-1:0]  db_s0 ,
+               db_s1 ,
+               db_s2 ,
+               db_state ;
+wire           db_tick = &db_div ;
+wire [gw-1:0]  db_all1 = ext_pad_s & db_s0 & db_s1 & db_s2 ;
+wire [gw-1:0]  db_all0 = ~(ext_pad_s | db_s0 | db_s1 | db_s2) ;
+
+always @(posedge wb_clk_i or posedge wb_rst_i)
+  if (wb_rst_i) begin
+    db_div   <= #1 {`GPIO_DEBOUNCE_TICK_W{1'b0}} ;
+    db_s0    <= #1 {gw{1'b0}} ;
+    db_s1    <= #1 {gw{1'b0}} ;
+    db_s2    <= #1 {gw{1'b0}} ;
+    db_state <= #1 {gw{1'b0}} ;
+  end else begin
+    db_div   <= #1 db_div + 1'b1 ;
+    if (db_tick) begin
+      db_s0    <= #1 ext_pad_s ;
+      db_s1    <= #1 db_s0 ;
+      db_s2    <= #1 db_s1 ;
+      db_state <= #1 (db_state | db_all1) & ~db_all0 ;
+    end
+  end
+
+assign  ext_pad_f = (db_state & `GPIO_DEBOUNCE_MASK) | (ext_pad_s & ~`GPIO_DEBOUNCE_MASK) ;
+`else
+assign  ext_pad_f = ext_pad_s ;
+`endif // GPIO_DEBOUNCE
   
 //
 // Latch into RGPIO_IN
@@ -811,7 +885,7 @@ assign pedge_vec = {gw{pedge}} ;
 assign nedge_vec = {gw{nedge}} ;   
 
 assign in_lach = (~rgpio_nec & pedge_vec) | (rgpio_nec & nedge_vec) ;
-assign extc_in = (in_lach & ext_pad_s) | (~in_lach & pextc_sampled) ;
+assign extc_in = (in_lach & ext_pad_f) | (~in_lach & pextc_sampled) ;
 
 always @(posedge wb_clk_i or posedge wb_rst_i)
   if (wb_rst_i) begin
@@ -831,7 +905,7 @@ always @(posedge wb_clk_i or posedge wb_rst_i)
     pextc_sampled <= #1 extc_in ;
   end
 
-assign in_muxed = (rgpio_eclk & pextc_sampled) | (~rgpio_eclk & ext_pad_s) ;
+assign in_muxed = (rgpio_eclk & pextc_sampled) | (~rgpio_eclk & ext_pad_f) ;
 
 `else
 //
@@ -965,7 +1039,7 @@ assign extc_in = (~rgpio_nec & pextc_sampled) | (rgpio_nec & nextc_sampled) ;
 
 `endif //  GPIO_NO_NEGEDGE_FLOPS
 
-assign in_muxed = (rgpio_eclk & extc_s)      | (~rgpio_eclk & ext_pad_s) ;
+assign in_muxed = (rgpio_eclk & extc_s)      | (~rgpio_eclk & ext_pad_f) ;
 
 
 `endif //  GPIO_SYNC_CLK_WB
@@ -973,7 +1047,7 @@ assign in_muxed = (rgpio_eclk & extc_s)      | (~rgpio_eclk & ext_pad_s) ;
 
 `else
 
-assign  in_muxed  = ext_pad_s ;
+assign  in_muxed  = ext_pad_f ;
 
 `endif //  GPIO_CLKPAD
 
@@ -991,6 +1065,21 @@ always @(wb_adr_i or rgpio_in or rgpio_out or rgpio_oe or rgpio_inte or
 			wb_dat[dw-1:0] = rgpio_out;
 		end
   `endif
+  `ifdef GPIO_RGPIO_OUT_SET
+		`GPIO_RGPIO_OUT_SET: begin
+			wb_dat[dw-1:0] = rgpio_out;
+		end
+  `endif
+  `ifdef GPIO_RGPIO_OUT_CLR
+		`GPIO_RGPIO_OUT_CLR: begin
+			wb_dat[dw-1:0] = rgpio_out;
+		end
+  `endif
+  `ifdef GPIO_RGPIO_OUT_TGL
+		`GPIO_RGPIO_OUT_TGL: begin
+			wb_dat[dw-1:0] = rgpio_out;
+		end
+  `endif
   `ifdef GPIO_RGPIO_OE
 		`GPIO_RGPIO_OE: begin
 			wb_dat[dw-1:0] = rgpio_oe;
@@ -6,17 +6,17 @@ module openmips_min_sopc(
     input  wire        rst_n,
     input  wire        flash_continue,
 
-    //  UART ӿ 
+    // 新增 UART 接口 
     input  wire          uart_in, 
     output wire          uart_out, 
 
-    //  16 λӿ 
+    // 新增 16 位输入接口 
     input  wire[15:0]    gpio_i, 
 
-    //  32 λӿ 
+    // 新增 32 位输出接口 
     output wire[31:0]    gpio_o, // 31:16-led, 15:8-o_seg, 7:0-o_sel
 
-    // ⲿ Flash Ľӿ 
+    // 新增与外部 Flash 相连的接口 
     // Flash
     output  cs_n,
     input   sdi,
@@ -24,7 +24,7 @@ module openmips_min_sopc(
     output  wp_n,
     output  hld_n, 
 
-    // ⲿ SDRAM Ľӿ 
+    // 新增与外部 SDRAM 相连的接口 
     // DDR2 
     inout [15:0]            ddr2_dq,
 	inout [1:0]             ddr2_dqs_n,
@@ -97,51 +97,223 @@ module openmips_min_sopc(
     wire        s3_stb_o; 
     wire        s3_ack_i;    
 
+    wire[31:0]  s4_data_i; 
+    wire[31:0]  s4_data_o; 
+    wire[31:0]  s4_addr_o; 
+    wire[3:0]   s4_sel_o; 
+    wire        s4_we_o;  
+    wire        s4_cyc_o;  
+    wire        s4_stb_o; 
+    wire        s4_ack_i;    
+
+    // 指令总线的 SDRAM 访问不经过总线互联矩阵，直接送到 SDRAM 控制器的指令端口 
+    wire        m1_ddr;  
+    wire[31:0]  m1_cm_data_o; 
+    wire        m1_cm_ack_o; 
+    wire[31:0]  ddr_i_data; 
+    wire        ddr_i_ack; 
+
+    wire[31:0]  m2_data_i; 
+    wire[31:0]  m2_data_o; 
+    wire[31:0]  m2_addr_i; 
+    wire[3:0]   m2_sel_i; 
+    wire        m2_we_i; 
+    wire        m2_cyc_i;  
+    wire        m2_stb_i; 
+    wire        m2_ack_o;    
+
+    wire[31:0]  s5_data_i; 
+    wire[31:0]  s5_data_o; 
+    wire[31:0]  s5_addr_o; 
+    wire[3:0]   s5_sel_o; 
+    wire        s5_we_o;  
+    wire        s5_cyc_o;  
+    wire        s5_stb_o; 
+    wire        s5_ack_i;    
+
+    wire[31:0]  s6_data_i; 
+    wire[31:0]  s6_data_o; 
+    wire[31:0]  s6_addr_o; 
+    wire[3:0]   s6_sel_o; 
+    wire        s6_we_o;  
+    wire        s6_cyc_o;  
+    wire        s6_stb_o; 
+    wire        s6_ack_i;    
+
+    wire[31:0]  s7_data_i; 
+    wire[31:0]  s7_data_o; 
+    wire[31:0]  s7_addr_o; 
+    wire[3:0]   s7_sel_o; 
+    wire        s7_we_o;  
+    wire        s7_cyc_o;  
+    wire        s7_stb_o; 
+    wire        s7_ack_i;    
+
+    wire[31:0]  s8_data_i; 
+    wire[31:0]  s8_data_o; 
+    wire[31:0]  s8_addr_o; 
+    wire[3:0]   s8_sel_o; 
+    wire        s8_we_o;  
+    wire        s8_cyc_o;  
+    wire        s8_stb_o; 
+    wire        s8_ack_i;    
+
+    wire[31:0]  s9_data_i; 
+    wire[31:0]  s9_data_o; 
+    wire[31:0]  s9_addr_o; 
+    wire[3:0]   s9_sel_o; 
+    wire        s9_we_o;  
+    wire        s9_cyc_o;  
+    wire        s9_stb_o; 
+    wire        s9_ack_i;    
+
+    wire[31:0]  s10_data_i; 
+    wire[31:0]  s10_data_o; 
+    wire[31:0]  s10_addr_o; 
+    wire[3:0]   s10_sel_o; 
+    wire        s10_we_o;  
+    wire        s10_cyc_o;  
+    wire        s10_stb_o; 
+    wire        s10_ack_i;    
+
+    wire[31:0]  s11_data_i; 
+    wire[31:0]  s11_data_o; 
+    wire[31:0]  s11_addr_o; 
+    wire[3:0]   s11_sel_o; 
+    wire        s11_we_o;  
+    wire        s11_cyc_o;  
+    wire        s11_stb_o; 
+    wire        s11_ack_i;    
+
     wire clk;
     wire rst;
     assign rst = ~rst_n;
     assign clk = clk_in;
 
 /**************************************************************** 
-***********        һΣʵ OpenMIPS        ********* 
+***********        第一段：例化实践版 OpenMIPS 处理器       ********* 
 *****************************************************************/ 
 
     wire [5:0] int;
-    wire timer_int, gpio_int, uart_int;
+    wire timer_int, gpio_int, uart_int, dma_int;
+    wire pic_int;
+    wire [3:0] tmr_int;
+    wire uart_tx_dreq, uart_rx_dreq, uart_tx_dack, uart_rx_dack;    // UART 与 DMA 之间的请求、应答
+    
+    // LL/SC 独占监视器的总线监听信号
+    wire        ll_snoop_we;
+    wire[31:0]  ll_snoop_addr;
+
+    // SDRAM 控制器的写队列已排空，供 sync 指令等待
+    wire        ddr_wq_empty;
  
 openmips openmips0( 
     .clk(clk), 
     .rst(rst), 
             
-    // ָ Wishbone ߽ӿӵ Wishbone ߻豸ӿ1 
+    // 指令 Wishbone 总线接口连接到 Wishbone 总线互联矩阵的主设备接口1 
     .iwishbone_data_i(m1_data_o),    .iwishbone_ack_i(m1_ack_o), 
     .iwishbone_addr_o(m1_addr_i),    .iwishbone_data_o(m1_data_i), 
     .iwishbone_we_o(m1_we_i),        .iwishbone_sel_o(m1_sel_i), 
     .iwishbone_stb_o(m1_stb_i),      .iwishbone_cyc_o(m1_cyc_i), 
-    .int_i(int),  // ˵ź int ĺ 
+    .int_i(int),  // 在下面会说明信号 int 的含义 
 
-    //  Wishbone ߽ӿӵ Wishbone ߻豸ӿ0 
+    // 数据 Wishbone 总线接口连接到 Wishbone 总线互联矩阵的主设备接口0 
     .dwishbone_data_i(m0_data_o),    .dwishbone_ack_i(m0_ack_o), 
     .dwishbone_addr_o(m0_addr_i),    .dwishbone_data_o(m0_data_i), 
     .dwishbone_we_o(m0_we_i),        .dwishbone_sel_o(m0_sel_i), 
     .dwishbone_stb_o(m0_stb_i),      .dwishbone_cyc_o(m0_cyc_i), 
+ 
+    .ll_snoop_we_i(ll_snoop_we),     .ll_snoop_addr_i(ll_snoop_addr), 
+    .mem_fence_done_i(ddr_wq_empty), 
         
     .timer_int_o(timer_int) 
 ); 
 
-   // OpenMIPS ж룬˴ʱжϡUART жϡGPIO ж 
-   assign int = {3'b000, gpio_int, uart_int, timer_int}; 
+   // OpenMIPS 处理器的中断输入，各个中断源都经过中断控制器，只使用 int_i[0] 
+   assign int = {5'b00000, pic_int}; 
+
+// 中断控制器的中断源：0 时钟中断（CP0 的 Count/Compare）、1 UART 中断、2 GPIO 中断、 
+// 3 DMA 完成中断、4 ~ 7 定时器通道 0 ~ 3 
+wb_pic wb_pic0(
+    .wb_clk_i(clk),              .wb_rst_i(rst), 
+
+    // 中断控制器连接到总线互联的从设备接口 8，地址是 0x80000000 
+    .wb_cyc_i(s8_cyc_o),         .wb_adr_i(s8_addr_o), 
+    .wb_dat_i(s8_data_o),        .wb_sel_i(s8_sel_o), 
+    .wb_we_i(s8_we_o),           .wb_stb_i(s8_stb_o), 
+    .wb_dat_o(s8_data_i),        .wb_ack_o(s8_ack_i), 
+
+    .irq_i({24'h000000, tmr_int, dma_int, gpio_int, uart_int, timer_int}), 
+    .int_o(pic_int) 
+);
+
+wb_timer wb_timer0(
+    .wb_clk_i(clk),              .wb_rst_i(rst), 
+
+    // 定时器连接到总线互联的从设备接口 9，地址是 0x90000000 
+    .wb_cyc_i(s9_cyc_o),         .wb_adr_i(s9_addr_o), 
+    .wb_dat_i(s9_data_o),        .wb_sel_i(s9_sel_o), 
+    .wb_we_i(s9_we_o),           .wb_stb_i(s9_stb_o), 
+    .wb_dat_o(s9_data_i),        .wb_ack_o(s9_ack_i), 
+
+    .int_o(tmr_int) 
+);
+
+/**************************************************************** 
+***********            例化 CRC 计算单元                ********* 
+*****************************************************************/ 
  
+wb_crc wb_crc0(
+    .wb_clk_i(clk),              .wb_rst_i(rst), 
+
+    // CRC 计算单元连接到总线互联的从设备接口 10，地址是 0xA0000000 
+    .wb_cyc_i(s10_cyc_o),        .wb_adr_i(s10_addr_o), 
+    .wb_dat_i(s10_data_o),       .wb_sel_i(s10_sel_o), 
+    .wb_we_i(s10_we_o),          .wb_stb_i(s10_stb_o), 
+    .wb_dat_o(s10_data_i),       .wb_ack_o(s10_ack_i) 
+);
+
 /**************************************************************** 
-***********               ڶΣ GPIO              ********* 
+***********               例化就绪表                  ********* 
+*****************************************************************/ 
+ 
+wb_rdylist wb_rdylist0(
+    .wb_clk_i(clk),              .wb_rst_i(rst), 
+
+    // 就绪表连接到总线互联的从设备接口 11，地址是 0xB0000000 
+    .wb_cyc_i(s11_cyc_o),        .wb_adr_i(s11_addr_o), 
+    .wb_dat_i(s11_data_o),       .wb_sel_i(s11_sel_o), 
+    .wb_we_i(s11_we_o),          .wb_stb_i(s11_stb_o), 
+    .wb_dat_o(s11_data_i),       .wb_ack_o(s11_ack_i) 
+);
+
+   // 独占监视器：SDRAM 从设备接口 s0 上完成了一次写操作，而这次应答不属于 
+   // OpenMIPS 的数据主设备 m0，说明是其它主设备（DMA 等）写了存储器，把地址 
+   // 送给 OpenMIPS，落在 ll 链接的粒度内就清除 LLbit 
+   assign ll_snoop_we   = s0_cyc_o & s0_stb_o & s0_we_o & s0_ack_i & 
+                          ~(m0_cyc_i & m0_stb_i & m0_ack_o & (m0_addr_i[31:28] == 4'h0)); 
+   assign ll_snoop_addr = s0_addr_o; 
+ 
+ 
+   // 指令总线地址的高 4 位为 0 表示访问 SDRAM（ITCM 命中时不会发起总线访问）， 
+   // 此时直接连到 SDRAM 控制器的指令端口，与数据总线、DMA 对 SDRAM 的访问在控制器 
+   // 内部交替进行，不再在总线互联矩阵的从设备接口 0 上排队 
+   assign m1_ddr    = (m1_addr_i[31:28] == 4'h0); 
+   assign m1_data_o = m1_ddr ? ddr_i_data : m1_cm_data_o; 
+   assign m1_ack_o  = m1_ddr ? ddr_i_ack  : m1_cm_ack_o; 
+ 
+/**************************************************************** 
+***********               第二段：例化 GPIO              ********* 
 *****************************************************************/ 
 
     wire sdram_init_done;
     wire [31:0] gpio_i_temp;
+    wire [31:0] gpio_out;          // GPIO 输出寄存器，[15:0] 可能被数码管控制器代替 
  
 gpio_top gpio_top0( 
 
-    // GPIO ӵ Wishbone ߻Ĵ豸ӿ 2 
+    // GPIO 连接到 Wishbone 总线互联矩阵的从设备接口 2 
     .wb_clk_i(clk),           .wb_rst_i(rst),  
     .wb_cyc_i(s2_cyc_o),      .wb_adr_i(s2_addr_o[7:0]), 
     .wb_dat_i(s2_data_o),     .wb_sel_i(s2_sel_o), 
@@ -151,28 +323,72 @@ gpio_top gpio_top0(
 
     .wb_inta_o(gpio_int), 
     .ext_pad_i(gpio_i_temp),  
-    .ext_pad_o(gpio_o),            // ӵ 32 λӿ 
+    .ext_pad_o(gpio_out),          // 连接到 32 位输出接口 
     .ext_padoe_o() 
     ); 
 
-//  SDRAM  sdram_init_done ҲΪ GPIO һ 
+// 将 SDRAM 控制器的输出 sdram_init_done 也作为 GPIO 的一个输入 
 assign gpio_i_temp = {15'h0000, sdram_init_done, gpio_i}; 
 
 /**************************************************************** 
-***********          Σ Flash             ********* 
+***********            例化数码管控制器                 ********* 
+*****************************************************************/ 
+ 
+    wire        seg_en;
+    wire [7:0]  seg_seg, seg_sel;
+
+seg7_wb seg7_wb0(
+    .wb_clk_i(clk),              .wb_rst_i(rst), 
+
+    // 数码管控制器连接到总线互联的从设备接口 7，地址是 0x70000000 
+    .wb_cyc_i(s7_cyc_o),         .wb_adr_i(s7_addr_o), 
+    .wb_dat_i(s7_data_o),        .wb_sel_i(s7_sel_o), 
+    .wb_we_i(s7_we_o),           .wb_stb_i(s7_stb_o), 
+    .wb_dat_o(s7_data_i),        .wb_ack_o(s7_ack_i), 
+
+    .seg_en_o(seg_en), 
+    .seg_o(seg_seg), 
+    .sel_o(seg_sel) 
+);
+
+// 数码管控制器使能后由它驱动段选和位选，LED 仍由 GPIO 驱动 
+assign gpio_o = {gpio_out[31:16], seg_en ? {seg_seg, seg_sel} : gpio_out[15:0]}; 
+
+/**************************************************************** 
+***********          第三段：例化 Flash 控制器            ********* 
 *****************************************************************/ 
  
+    // XIP 读缓存与 flash_rom 之间的连线 
+    wire        fl_cyc, fl_stb, fl_we, fl_ack;
+    wire[3:0]   fl_sel;
+    wire[23:0]  fl_addr;
+    wire[31:0]  fl_data_w, fl_data_r;
+
+// XIP 读缓存连接到 Wishbone 总线互联矩阵的从设备接口 3，缺失时通过 flash_rom 读取一整行 
+flash_cache flash_cache0(
+    .wb_clk_i(clk_in),           .wb_rst_i(rst),
+    .wb_cyc_i(s3_cyc_o),         .wb_stb_i(s3_stb_o),
+    .wb_we_i(s3_we_o),           .wb_sel_i(s3_sel_o),
+    .wb_adr_i(s3_addr_o),        .wb_dat_i(s3_data_o),
+    .wb_dat_o(s3_data_i),        .wb_ack_o(s3_ack_i),
+
+    .fl_cyc_o(fl_cyc),           .fl_stb_o(fl_stb),
+    .fl_we_o(fl_we),             .fl_sel_o(fl_sel),
+    .fl_adr_o(fl_addr),          .fl_dat_o(fl_data_w),
+    .fl_dat_i(fl_data_r),        .fl_ack_i(fl_ack)
+);
+
 flash_rom flash_rom(
     .wb_clk_i(clk_in), //100MHz
     .wb_rst_i(rst),
-    .wb_adr_i({s3_addr_o[23:2],2'b00}),
-    .wb_dat_o(s3_data_i),
-    .wb_dat_i(s3_data_o),
-    .wb_sel_i(s3_sel_o),
-    .wb_we_i(s3_we_o),
-    .wb_stb_i(s3_stb_o), 
-    .wb_cyc_i(s3_cyc_o), 
-    .wb_ack_o(s3_ack_i),
+    .wb_adr_i(fl_addr),
+    .wb_dat_o(fl_data_r),
+    .wb_dat_i(fl_data_w),
+    .wb_sel_i(fl_sel),
+    .wb_we_i(fl_we),
+    .wb_stb_i(fl_stb), 
+    .wb_cyc_i(fl_cyc), 
+    .wb_ack_o(fl_ack),
     
     .flash_continue(flash_continue),
     .cs_n(cs_n),
@@ -183,30 +399,104 @@ flash_rom flash_rom(
 );
  
 /**************************************************************** 
-***********           ĶΣ UART              ********* 
+***********          例化片上启动 ROM（BootLoader）         ********* 
+*****************************************************************/ 
+ 
+`ifdef BOOT_ROM 
+
+boot_rom boot_rom0(
+
+    // 启动 ROM 连接到 Wishbone 总线互联矩阵的从设备接口 4，地址是 0x40000000 
+    .wb_clk_i(clk),              .wb_rst_i(rst), 
+    .wb_cyc_i(s4_cyc_o),         .wb_adr_i(s4_addr_o), 
+    .wb_dat_i(s4_data_o),        .wb_sel_i(s4_sel_o), 
+    .wb_we_i(s4_we_o),           .wb_stb_i(s4_stb_o), 
+    .wb_dat_o(s4_data_i),        .wb_ack_o(s4_ack_i) 
+);
+
+`else 
+
+// 没有启动 ROM 时从设备接口 4 与原来一样空着 
+assign s4_data_i = 32'h00000000; 
+assign s4_ack_i  = 1'b0; 
+
+`endif 
+ 
+/**************************************************************** 
+***********           第四段：例化 UART 控制器             ********* 
 *****************************************************************/ 
  
 uart_top uart_top0( 
  
-    // UART ӵ Wishbone ߻Ĵ豸ӿ 1 
+    // UART 控制器连接到 Wishbone 总线互联矩阵的从设备接口 1 
     .wb_clk_i(clk),              .wb_rst_i(rst), 
     .wb_adr_i(s1_addr_o[4:0]),   .wb_dat_i(s1_data_o), 
     .wb_dat_o(s1_data_i),        .wb_we_i(s1_we_o),  
     .wb_stb_i(s1_stb_o),         .wb_cyc_i(s1_cyc_o), 
     .wb_ack_o(s1_ack_i),         .wb_sel_i(s1_sel_o), 
         
-    // ж 
+    // 串口中断 
     .int_o(uart_int), 
         
-    //  UART ӿ 
+    // 连接 UART 接口 
     .stx_pad_o(uart_out),        .srx_pad_i(uart_in), 
     .cts_pad_i(1'b0),            .dsr_pad_i(1'b0),  
     .ri_pad_i(1'b0),             .dcd_pad_i(1'b0), 
-    .rts_pad_o(),                .dtr_pad_o() 
+    .rts_pad_o(),                .dtr_pad_o(), 
+
+    // 发送 FIFO 未满、接收 FIFO 非空时向 DMA 发出请求 
+    .tx_dreq_o(uart_tx_dreq),    .rx_dreq_o(uart_rx_dreq), 
+    .tx_dack_i(uart_tx_dack),    .rx_dack_i(uart_rx_dack) 
 );
 
 /**************************************************************** 
-***********           Σ SDRAM             ********* 
+***********              例化 DMA 控制器                ********* 
+*****************************************************************/ 
+ 
+wb_dma wb_dma0(
+    .wb_clk_i(clk),              .wb_rst_i(rst), 
+
+    // DMA 的寄存器接口连接到 Wishbone 总线互联矩阵的从设备接口 5，地址是 0x50000000 
+    .wb_cyc_i(s5_cyc_o),         .wb_adr_i(s5_addr_o), 
+    .wb_dat_i(s5_data_o),        .wb_sel_i(s5_sel_o), 
+    .wb_we_i(s5_we_o),           .wb_stb_i(s5_stb_o), 
+    .wb_dat_o(s5_data_i),        .wb_ack_o(s5_ack_i), 
+
+    // DMA 搬运数据使用 Wishbone 总线互联矩阵的主设备接口 2 
+    .m_cyc_o(m2_cyc_i),          .m_stb_o(m2_stb_i), 
+    .m_we_o(m2_we_i),            .m_sel_o(m2_sel_i), 
+    .m_adr_o(m2_addr_i),         .m_dat_o(m2_data_i), 
+    .m_dat_i(m2_data_o),         .m_ack_i(m2_ack_o), 
+
+    // 请求线 0 为 UART 发送，1 为 UART 接收 
+    .dreq_i({uart_rx_dreq, uart_tx_dreq}), 
+    .dack_o({uart_rx_dack, uart_tx_dack}), 
+
+    .int_o(dma_int)
+);
+
+/**************************************************************** 
+***********            例化总线性能监视器               ********* 
+*****************************************************************/ 
+ 
+wb_perf_mon wb_perf_mon0(
+    .wb_clk_i(clk),              .wb_rst_i(rst), 
+
+    // 性能监视器的寄存器连接到总线互联的从设备接口 6，地址是 0x60000000 
+    .wb_cyc_i(s6_cyc_o),         .wb_adr_i(s6_addr_o), 
+    .wb_dat_i(s6_data_o),        .wb_sel_i(s6_sel_o), 
+    .wb_we_i(s6_we_o),           .wb_stb_i(s6_stb_o), 
+    .wb_dat_o(s6_data_i),        .wb_ack_o(s6_ack_i), 
+
+    // 在主设备一侧旁听：数据总线、指令总线（包括 SDRAM 指令端口）、DMA 
+    .mon_cyc_i({m2_cyc_i, m1_cyc_i, m0_cyc_i}), 
+    .mon_stb_i({m2_stb_i, m1_stb_i, m0_stb_i}), 
+    .mon_ack_i({m2_ack_o, m1_ack_o, m0_ack_o}), 
+    .mon_adr_i({m2_addr_i, m1_addr_i, m0_addr_i}) 
+);
+
+/**************************************************************** 
+***********           第五段：例化 SDRAM 控制器            ********* 
 *****************************************************************/ 
  
 DDR2 DDR2(
@@ -221,8 +511,15 @@ DDR2 DDR2(
     .wb_sel_i(s0_sel_o),
     .wb_dat_o(s0_data_i),
     .wb_cyc_i(s0_cyc_o),
+
+    .wbi_cyc_i(m1_cyc_i & m1_ddr),
+    .wbi_stb_i(m1_stb_i & m1_ddr),
+    .wbi_adr_i({m1_addr_i[26:2],2'b00}),
+    .wbi_dat_o(ddr_i_data),
+    .wbi_ack_o(ddr_i_ack),
     
     .init_calib_complete(sdram_init_done),
+    .wq_empty_o(ddr_wq_empty),
 
     .ddr2_ck_p(ddr2_ck_p),
     .ddr2_ck_n(ddr2_ck_n),
@@ -241,177 +538,280 @@ DDR2 DDR2(
 );
 
 /**************************************************************** 
-***********            Σ WB_CONMAX            ********* 
+***********            第六段：例化 WB_CONMAX            ********* 
 *****************************************************************/ 
  
+`ifdef WB_LITE_INTERCON 
+
+// 精简的总线互联，只有本系统用到的 3 个主设备和 7 个从设备，仲裁和地址译码不增加周期 
+wb_lite_intercon #(.REGISTERED(`WBLiteRegistered)) wb_lite_intercon0( 
+
+    .clk_i(clk),        .rst_i(rst), 
+
+    // 主设备接口 0，连接到 OpenMIPS 处理器的数据 Wishbone 总线接口 
+    .m0_data_i(m0_data_i),       .m0_data_o(m0_data_o), 
+    .m0_addr_i(m0_addr_i),       .m0_sel_i(m0_sel_i), 
+    .m0_we_i(m0_we_i),           .m0_cyc_i(m0_cyc_i),  
+    .m0_stb_i(m0_stb_i),         .m0_ack_o(m0_ack_o),  
+
+    // 主设备接口 1，连接到 OpenMIPS 处理器的指令 Wishbone 总线接口（SDRAM 以外的地址） 
+    .m1_data_i(m1_data_i),       .m1_data_o(m1_cm_data_o), 
+    .m1_addr_i(m1_addr_i),       .m1_sel_i(m1_sel_i), 
+    .m1_we_i(m1_we_i),           .m1_cyc_i(m1_cyc_i & ~m1_ddr),  
+    .m1_stb_i(m1_stb_i & ~m1_ddr), .m1_ack_o(m1_cm_ack_o),  
+
+    // 主设备接口 2，连接到 DMA 控制器 
+    .m2_data_i(m2_data_i),       .m2_data_o(m2_data_o), 
+    .m2_addr_i(m2_addr_i),       .m2_sel_i(m2_sel_i), 
+    .m2_we_i(m2_we_i),           .m2_cyc_i(m2_cyc_i),  
+    .m2_stb_i(m2_stb_i),         .m2_ack_o(m2_ack_o),  
+
+    // 从设备接口 0，连接到 SDRAM 控制器 
+    .s0_data_i(s0_data_i),       .s0_data_o(s0_data_o), 
+    .s0_addr_o(s0_addr_o),       .s0_sel_o(s0_sel_o), 
+    .s0_we_o(s0_we_o),           .s0_cyc_o(s0_cyc_o),  
+    .s0_stb_o(s0_stb_o),         .s0_ack_i(s0_ack_i),  
+
+    // 从设备接口 1，连接到 UART 控制器 
+    .s1_data_i(s1_data_i),       .s1_data_o(s1_data_o), 
+    .s1_addr_o(s1_addr_o),       .s1_sel_o(s1_sel_o), 
+    .s1_we_o(s1_we_o),           .s1_cyc_o(s1_cyc_o),  
+    .s1_stb_o(s1_stb_o),         .s1_ack_i(s1_ack_i),  
+
+    // 从设备接口 2，连接到 GPIO 
+    .s2_data_i(s2_data_i),       .s2_data_o(s2_data_o), 
+    .s2_addr_o(s2_addr_o),       .s2_sel_o(s2_sel_o), 
+    .s2_we_o(s2_we_o),           .s2_cyc_o(s2_cyc_o),  
+    .s2_stb_o(s2_stb_o),         .s2_ack_i(s2_ack_i),  
+
+    // 从设备接口 3，连接到 Flash 控制器 
+    .s3_data_i(s3_data_i),       .s3_data_o(s3_data_o), 
+    .s3_addr_o(s3_addr_o),       .s3_sel_o(s3_sel_o), 
+    .s3_we_o(s3_we_o),           .s3_cyc_o(s3_cyc_o),  
+    .s3_stb_o(s3_stb_o),         .s3_ack_i(s3_ack_i),  
+
+    // 从设备接口 4，连接到片上启动 ROM 
+    .s4_data_i(s4_data_i),       .s4_data_o(s4_data_o), 
+    .s4_addr_o(s4_addr_o),       .s4_sel_o(s4_sel_o), 
+    .s4_we_o(s4_we_o),           .s4_cyc_o(s4_cyc_o),  
+    .s4_stb_o(s4_stb_o),         .s4_ack_i(s4_ack_i),  
+
+    // 从设备接口 5，连接到 DMA 控制器的寄存器 
+    .s5_data_i(s5_data_i),       .s5_data_o(s5_data_o), 
+    .s5_addr_o(s5_addr_o),       .s5_sel_o(s5_sel_o), 
+    .s5_we_o(s5_we_o),           .s5_cyc_o(s5_cyc_o),  
+    .s5_stb_o(s5_stb_o),         .s5_ack_i(s5_ack_i),  
+
+    // 从设备接口 6，连接到总线性能监视器 
+    .s6_data_i(s6_data_i),       .s6_data_o(s6_data_o), 
+    .s6_addr_o(s6_addr_o),       .s6_sel_o(s6_sel_o), 
+    .s6_we_o(s6_we_o),           .s6_cyc_o(s6_cyc_o),  
+    .s6_stb_o(s6_stb_o),         .s6_ack_i(s6_ack_i), 
+
+    // 从设备接口 7，连接到数码管控制器 
+    .s7_data_i(s7_data_i),       .s7_data_o(s7_data_o), 
+    .s7_addr_o(s7_addr_o),       .s7_sel_o(s7_sel_o), 
+    .s7_we_o(s7_we_o),           .s7_cyc_o(s7_cyc_o),  
+    .s7_stb_o(s7_stb_o),         .s7_ack_i(s7_ack_i), 
+
+    // 从设备接口 8，连接到中断控制器 
+    .s8_data_i(s8_data_i),       .s8_data_o(s8_data_o), 
+    .s8_addr_o(s8_addr_o),       .s8_sel_o(s8_sel_o), 
+    .s8_we_o(s8_we_o),           .s8_cyc_o(s8_cyc_o),  
+    .s8_stb_o(s8_stb_o),         .s8_ack_i(s8_ack_i), 
+
+    // 从设备接口 9，连接到定时器 
+    .s9_data_i(s9_data_i),       .s9_data_o(s9_data_o), 
+    .s9_addr_o(s9_addr_o),       .s9_sel_o(s9_sel_o), 
+    .s9_we_o(s9_we_o),           .s9_cyc_o(s9_cyc_o),  
+    .s9_stb_o(s9_stb_o),         .s9_ack_i(s9_ack_i), 
+
+    // 从设备接口 10，连接到 CRC 计算单元 
+    .s10_data_i(s10_data_i),     .s10_data_o(s10_data_o), 
+    .s10_addr_o(s10_addr_o),     .s10_sel_o(s10_sel_o), 
+    .s10_we_o(s10_we_o),         .s10_cyc_o(s10_cyc_o),  
+    .s10_stb_o(s10_stb_o),       .s10_ack_i(s10_ack_i), 
+
+    // 从设备接口 11，连接到就绪表 
+    .s11_data_i(s11_data_i),     .s11_data_o(s11_data_o), 
+    .s11_addr_o(s11_addr_o),     .s11_sel_o(s11_sel_o), 
+    .s11_we_o(s11_we_o),         .s11_cyc_o(s11_cyc_o),  
+    .s11_stb_o(s11_stb_o),       .s11_ack_i(s11_ack_i) 
+    ); 
+
+`else 
+
 wb_conmax_top wb_conmax_top0( 
 
     .clk_i(clk),        .rst_i(rst), 
 
-    // 豸ӿ 0ӵ OpenMIPS  Wishbone ߽ӿ 
+    // 主设备接口 0，连接到 OpenMIPS 处理器的数据 Wishbone 总线接口 
     .m0_data_i(m0_data_i),       .m0_data_o(m0_data_o), 
     .m0_addr_i(m0_addr_i),       .m0_sel_i(m0_sel_i), 
     .m0_we_i(m0_we_i),           .m0_cyc_i(m0_cyc_i),  
     .m0_stb_i(m0_stb_i),         .m0_ack_o(m0_ack_o),  
 
-    // 豸ӿ 1ӵ OpenMIPS ָ Wishbone ߽ӿ 
-    .m1_data_i(m1_data_i),       .m1_data_o(m1_data_o), 
+    // 主设备接口 1，连接到 OpenMIPS 处理器的指令 Wishbone 总线接口（SDRAM 以外的地址） 
+    .m1_data_i(m1_data_i),       .m1_data_o(m1_cm_data_o), 
     .m1_addr_i(m1_addr_i),       .m1_sel_i(m1_sel_i), 
-    .m1_we_i(m1_we_i),           .m1_cyc_i(m1_cyc_i),  
-    .m1_stb_i(m1_stb_i),         .m1_ack_o(m1_ack_o),  
-
-    // 豸ӿ 2  
-    .m2_data_i(`ZeroWord),       .m2_data_o(), 
-    .m2_addr_i(`ZeroWord),       .m2_sel_i(4'b0000), 
-    .m2_we_i(1'b0),              .m2_cyc_i(1'b0),  
-    .m2_stb_i(1'b0),             .m2_ack_o(),  
+    .m1_we_i(m1_we_i),           .m1_cyc_i(m1_cyc_i & ~m1_ddr),  
+    .m1_stb_i(m1_stb_i & ~m1_ddr), .m1_ack_o(m1_cm_ack_o),  
+
+    // 主设备接口 2，连接到 DMA 控制器 
+    .m2_data_i(m2_data_i),       .m2_data_o(m2_data_o), 
+    .m2_addr_i(m2_addr_i),       .m2_sel_i(m2_sel_i), 
+    .m2_we_i(m2_we_i),           .m2_cyc_i(m2_cyc_i),  
+    .m2_stb_i(m2_stb_i),         .m2_ack_o(m2_ack_o),  
     .m2_err_o(),                 .m2_rty_o(), 
 
-    // 豸ӿ 3  
+    // 主设备接口 3  
     .m3_data_i(`ZeroWord),       .m3_data_o(), 
     .m3_addr_i(`ZeroWord),       .m3_sel_i(4'b0000), 
     .m3_we_i(1'b0),              .m3_cyc_i(1'b0),  
     .m3_stb_i(1'b0),             .m3_ack_o(),  
     .m3_err_o(),                 .m3_rty_o(), 
 
-    // 豸ӿ 4  
+    // 主设备接口 4  
     .m4_data_i(`ZeroWord),       .m4_data_o(), 
     .m4_addr_i(`ZeroWord),       .m4_sel_i(4'b0000), 
     .m4_we_i(1'b0),              .m4_cyc_i(1'b0),  
     .m4_stb_i(1'b0),             .m4_ack_o(),  
     .m4_err_o(),                 .m4_rty_o(), 
 
-    // 豸ӿ 5  
+    // 主设备接口 5  
     .m5_data_i(`ZeroWord),       .m5_data_o(), 
     .m5_addr_i(`ZeroWord),       .m5_sel_i(4'b0000), 
     .m5_we_i(1'b0),              .m5_cyc_i(1'b0),  
     .m5_stb_i(1'b0),             .m5_ack_o(),  
     .m5_err_o(),                 .m5_rty_o(), 
 
-    // 豸ӿ 6  
+    // 主设备接口 6  
     .m6_data_i(`ZeroWord),       .m6_data_o(), 
     .m6_addr_i(`ZeroWord),       .m6_sel_i(4'b0000), 
     .m6_we_i(1'b0),              .m6_cyc_i(1'b0), 
     .m6_stb_i(1'b0),             .m6_ack_o(),  
     .m6_err_o(),                 .m6_rty_o(), 
 
-    // 豸ӿ 7  
+    // 主设备接口 7  
     .m7_data_i(`ZeroWord),       .m7_data_o(), 
     .m7_addr_i(`ZeroWord),       .m7_sel_i(4'b0000), 
     .m7_we_i(1'b0),              .m7_cyc_i(1'b0),  
     .m7_stb_i(1'b0),             .m7_ack_o(),  
     .m7_err_o(),                 .m7_rty_o(), 
 
-    // 豸ӿ 0ӵ SDRAM  
+    // 从设备接口 0，连接到 SDRAM 控制器 
     .s0_data_i(s0_data_i),       .s0_data_o(s0_data_o), 
     .s0_addr_o(s0_addr_o),       .s0_sel_o(s0_sel_o), 
     .s0_we_o(s0_we_o),           .s0_cyc_o(s0_cyc_o),  
     .s0_stb_o(s0_stb_o),         .s0_ack_i(s0_ack_i),  
     .s0_err_i(1'b0),             .s0_rty_i(1'b0), 
 
-    // 豸ӿ 1ӵ UART  
+    // 从设备接口 1，连接到 UART 控制器 
     .s1_data_i(s1_data_i),       .s1_data_o(s1_data_o), 
     .s1_addr_o(s1_addr_o),       .s1_sel_o(s1_sel_o), 
     .s1_we_o(s1_we_o),           .s1_cyc_o(s1_cyc_o),  
     .s1_stb_o(s1_stb_o),         .s1_ack_i(s1_ack_i),  
     .s1_err_i(1'b0),             .s1_rty_i(1'b0), 
 
-    // 豸ӿ 2ӵ GPIO 
+    // 从设备接口 2，连接到 GPIO 
     .s2_data_i(s2_data_i),       .s2_data_o(s2_data_o), 
     .s2_addr_o(s2_addr_o),       .s2_sel_o(s2_sel_o), 
     .s2_we_o(s2_we_o),           .s2_cyc_o(s2_cyc_o),  
     .s2_stb_o(s2_stb_o),         .s2_ack_i(s2_ack_i),  
     .s2_err_i(1'b0),             .s2_rty_i(1'b0), 
 
-    // 豸ӿ 3ӵ Flash  
+    // 从设备接口 3，连接到 Flash 控制器 
     .s3_data_i(s3_data_i),       .s3_data_o(s3_data_o), 
     .s3_addr_o(s3_addr_o),       .s3_sel_o(s3_sel_o), 
     .s3_we_o(s3_we_o),           .s3_cyc_o(s3_cyc_o),  
     .s3_stb_o(s3_stb_o),         .s3_ack_i(s3_ack_i),  
     .s3_err_i(1'b0),             .s3_rty_i(1'b0), 
 
-    // 豸ӿ 4  
-    .s4_data_i(),                .s4_data_o(), 
-    .s4_addr_o(),                .s4_sel_o(), 
-    .s4_we_o(),                  .s4_cyc_o(),  
-    .s4_stb_o(),                 .s4_ack_i(1'b0),  
+    // 从设备接口 4，连接到片上启动 ROM 
+    .s4_data_i(s4_data_i),       .s4_data_o(s4_data_o), 
+    .s4_addr_o(s4_addr_o),       .s4_sel_o(s4_sel_o), 
+    .s4_we_o(s4_we_o),           .s4_cyc_o(s4_cyc_o),  
+    .s4_stb_o(s4_stb_o),         .s4_ack_i(s4_ack_i),  
     .s4_err_i(1'b0),             .s4_rty_i(1'b0), 
 
-    // 豸ӿ 5  
-    .s5_data_i(),                .s5_data_o(), 
-    .s5_addr_o(),                .s5_sel_o(), 
-    .s5_we_o(),                  .s5_cyc_o(),  
-    .s5_stb_o(),                 .s5_ack_i(1'b0),  
+    // 从设备接口 5，连接到 DMA 控制器的寄存器 
+    .s5_data_i(s5_data_i),       .s5_data_o(s5_data_o), 
+    .s5_addr_o(s5_addr_o),       .s5_sel_o(s5_sel_o), 
+    .s5_we_o(s5_we_o),           .s5_cyc_o(s5_cyc_o),  
+    .s5_stb_o(s5_stb_o),         .s5_ack_i(s5_ack_i),  
     .s5_err_i(1'b0),             .s5_rty_i(1'b0),
-    // 豸ӿ 6  
-    .s6_data_i(),                .s6_data_o(), 
-    .s6_addr_o(),                .s6_sel_o(), 
-    .s6_we_o(),                  .s6_cyc_o(),  
-    .s6_stb_o(),                 .s6_ack_i(1'b0),  
+
+    // 从设备接口 6，连接到总线性能监视器 
+    .s6_data_i(s6_data_i),       .s6_data_o(s6_data_o), 
+    .s6_addr_o(s6_addr_o),       .s6_sel_o(s6_sel_o), 
+    .s6_we_o(s6_we_o),           .s6_cyc_o(s6_cyc_o),  
+    .s6_stb_o(s6_stb_o),         .s6_ack_i(s6_ack_i),  
     .s6_err_i(1'b0),             .s6_rty_i(1'b0), 
 
-    // 豸ӿ 7  
-    .s7_data_i(),                .s7_data_o(), 
-    .s7_addr_o(),                .s7_sel_o(), 
-    .s7_we_o(),                  .s7_cyc_o(),  
-    .s7_stb_o(),                 .s7_ack_i(1'b0),  
+    // 从设备接口 7，连接到数码管控制器 
+    .s7_data_i(s7_data_i),       .s7_data_o(s7_data_o), 
+    .s7_addr_o(s7_addr_o),       .s7_sel_o(s7_sel_o), 
+    .s7_we_o(s7_we_o),           .s7_cyc_o(s7_cyc_o),  
+    .s7_stb_o(s7_stb_o),         .s7_ack_i(s7_ack_i),  
     .s7_err_i(1'b0),             .s7_rty_i(1'b0), 
 
-    // 豸ӿ 8  
-    .s8_data_i(),                .s8_data_o(), 
-    .s8_addr_o(),                .s8_sel_o(), 
-    .s8_we_o(),                  .s8_cyc_o(),  
-    .s8_stb_o(),                 .s8_ack_i(1'b0),  
+    // 从设备接口 8，连接到中断控制器 
+    .s8_data_i(s8_data_i),       .s8_data_o(s8_data_o), 
+    .s8_addr_o(s8_addr_o),       .s8_sel_o(s8_sel_o), 
+    .s8_we_o(s8_we_o),           .s8_cyc_o(s8_cyc_o),  
+    .s8_stb_o(s8_stb_o),         .s8_ack_i(s8_ack_i),  
     .s8_err_i(1'b0),             .s8_rty_i(1'b0), 
 
-    // 豸ӿ 9  
-    .s9_data_i(),                .s9_data_o(), 
-    .s9_addr_o(),                .s9_sel_o(), 
-    .s9_we_o(),                  .s9_cyc_o(),  
-    .s9_stb_o(),                 .s9_ack_i(1'b0),  
+    // 从设备接口 9，连接到定时器 
+    .s9_data_i(s9_data_i),       .s9_data_o(s9_data_o), 
+    .s9_addr_o(s9_addr_o),       .s9_sel_o(s9_sel_o), 
+    .s9_we_o(s9_we_o),           .s9_cyc_o(s9_cyc_o),  
+    .s9_stb_o(s9_stb_o),         .s9_ack_i(s9_ack_i),  
     .s9_err_i(1'b0),             .s9_rty_i(1'b0), 
 
-    // 豸ӿ 10  
-    .s10_data_i(),               .s10_data_o(), 
-    .s10_addr_o(),               .s10_sel_o(), 
-    .s10_we_o(),                 .s10_cyc_o(),  
-    .s10_stb_o(),                .s10_ack_i(1'b0),  
+    // 从设备接口 10，连接到 CRC 计算单元 
+    .s10_data_i(s10_data_i),     .s10_data_o(s10_data_o), 
+    .s10_addr_o(s10_addr_o),     .s10_sel_o(s10_sel_o), 
+    .s10_we_o(s10_we_o),         .s10_cyc_o(s10_cyc_o),  
+    .s10_stb_o(s10_stb_o),       .s10_ack_i(s10_ack_i),  
     .s10_err_i(1'b0),            .s10_rty_i(1'b0), 
 
-    // 豸ӿ 11  
-    .s11_data_i(),               .s11_data_o(), 
-    .s11_addr_o(),               .s11_sel_o(), 
-    .s11_we_o(),                 .s11_cyc_o(),  
-    .s11_stb_o(),                .s11_ack_i(1'b0),  
+    // 从设备接口 11，连接到就绪表 
+    .s11_data_i(s11_data_i),     .s11_data_o(s11_data_o), 
+    .s11_addr_o(s11_addr_o),     .s11_sel_o(s11_sel_o), 
+    .s11_we_o(s11_we_o),         .s11_cyc_o(s11_cyc_o),  
+    .s11_stb_o(s11_stb_o),       .s11_ack_i(s11_ack_i),  
     .s11_err_i(1'b0),            .s11_rty_i(1'b0), 
 
-    // 豸ӿ 12  
+    // 从设备接口 12  
     .s12_data_i(),               .s12_data_o(),
     .s12_addr_o(),               .s12_sel_o(), 
     .s12_we_o(),                 .s12_cyc_o(),  
     .s12_stb_o(),                .s12_ack_i(1'b0),  
     .s12_err_i(1'b0),            .s12_rty_i(1'b0), 
 
-    // 豸ӿ 13  
+    // 从设备接口 13  
     .s13_data_i(),               .s13_data_o(), 
     .s13_addr_o(),               .s13_sel_o(), 
     .s13_we_o(),                 .s13_cyc_o(),  
     .s13_stb_o(),                .s13_ack_i(1'b0),  
     .s13_err_i(1'b0),            .s13_rty_i(1'b0), 
 
-    // 豸ӿ 14  
+    // 从设备接口 14  
     .s14_data_i(),               .s14_data_o(), 
     .s14_addr_o(),               .s14_sel_o(), 
     .s14_we_o(),                 .s14_cyc_o(),  
     .s14_stb_o(),                .s14_ack_i(1'b0),  
     .s14_err_i(1'b0),            .s14_rty_i(1'b0), 
 
-    // 豸ӿ 15  
+    // 从设备接口 15  
     .s15_data_i(),               .s15_data_o(), 
     .s15_addr_o(),               .s15_sel_o(), 
     .s15_we_o(),                 .s15_cyc_o(),  
     .s15_stb_o(),                .s15_ack_i(1'b0),  
     .s15_err_i(1'b0),            .s15_rty_i(1'b0)
     ); 
+
+`endif 
  
 endmodule 
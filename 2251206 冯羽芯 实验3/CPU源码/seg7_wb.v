@@ -0,0 +1,167 @@
+`timescale 1ns / 1ps
+
+// 八位数码管控制器：挂在总线互联的从设备接口 7（0x70000000），处理器只需写显示缓冲，
+// 由硬件完成动态扫描和译码，显示一个数只要一条 sw 指令
+//
+// 寄存器（都按字访问）：
+//   0x00 CTRL  [0] EN 为 1 时由本模块驱动数码管（gpio_o[15:0]），为 0 时仍由 GPIO 输出寄存器驱动
+//              [1] RAW 为 0 时按十六进制显示 HEX，为 1 时直接输出 RAW0、RAW1 中的段码
+//              [2] LZB 十六进制模式下熄灭高位的 0（第 0 位总是显示），写入 BCD 码即可显示十进制数
+//              [15:8] DP 十六进制模式下每一位的小数点，1 点亮
+//              [23:16] BLANK 每一位的消隐，1 熄灭，两种模式都有效
+//   0x04 HEX   8 个十六进制数字，[3:0] 为最右边的第 0 位
+//   0x08 RAW0  第 0 ~ 3 位的段码，每位一个字节，[7:0] 为第 0 位
+//   0x0C RAW1  第 4 ~ 7 位的段码
+// 段码与实验 1 的 seg7x16 相同：低电平点亮，[7] 为小数点，[6:0] 为 g ~ a
+module seg7_wb #(
+    parameter SCAN_DIV_LOG2 = 15         // 每 2^SCAN_DIV_LOG2 个周期换一位，100MHz 时每位约 0.33ms
+)(
+    // Wishbone 总线接口
+    input wire        wb_clk_i,        // Wishbone 时钟
+    input wire        wb_rst_i,        // Wishbone 复位
+    input wire        wb_cyc_i,        // Wishbone 总线周期有效
+    input wire        wb_stb_i,        // Wishbone 选通信号
+    input wire        wb_we_i,         // Wishbone 写使能
+    input wire [3:0]  wb_sel_i,        // Wishbone 字节选择
+    input wire [31:0] wb_adr_i,        // Wishbone 地址
+    input wire [31:0] wb_dat_i,        // Wishbone 写数据
+    output reg [31:0] wb_dat_o,        // Wishbone 读数据
+    output reg        wb_ack_o,        // Wishbone 应答
+
+    // 数码管接口
+    output wire       seg_en_o,        // 为 1 时用下面的信号代替 GPIO 输出寄存器的 [15:0]
+    output reg [7:0]  seg_o,           // 段选，低电平有效
+    output reg [7:0]  sel_o            // 位选，低电平有效
+    );
+
+reg [31:0] ctrl;
+reg [31:0] hex;
+reg [31:0] raw0;
+reg [31:0] raw1;
+
+assign seg_en_o = ctrl[0];
+
+// 按字节选择写寄存器
+function [31:0] merge;
+    input [31:0] old;
+    input [31:0] din;
+    input [3:0]  sel;
+    begin
+        merge[7:0]   = sel[0] ? din[7:0]   : old[7:0];
+        merge[15:8]  = sel[1] ? din[15:8]  : old[15:8];
+        merge[23:16] = sel[2] ? din[23:16] : old[23:16];
+        merge[31:24] = sel[3] ? din[31:24] : old[31:24];
+    end
+endfunction
+
+// 十六进制数字译码为段码
+function [6:0] hex2seg;
+    input [3:0] d;
+    begin
+        case(d)
+        4'h0: hex2seg = 7'h40;
+        4'h1: hex2seg = 7'h79;
+        4'h2: hex2seg = 7'h24;
+        4'h3: hex2seg = 7'h30;
+        4'h4: hex2seg = 7'h19;
+        4'h5: hex2seg = 7'h12;
+        4'h6: hex2seg = 7'h02;
+        4'h7: hex2seg = 7'h78;
+        4'h8: hex2seg = 7'h00;
+        4'h9: hex2seg = 7'h10;
+        4'hA: hex2seg = 7'h08;
+        4'hB: hex2seg = 7'h03;
+        4'hC: hex2seg = 7'h46;
+        4'hD: hex2seg = 7'h21;
+        4'hE: hex2seg = 7'h06;
+        default: hex2seg = 7'h0E;
+        endcase
+    end
+endfunction
+
+wire       req = wb_cyc_i & wb_stb_i & ~wb_ack_o;
+wire [1:0] reg_idx = wb_adr_i[3:2];
+
+// 寄存器访问，应答只保持一个周期
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        ctrl     <= 32'h00000000;
+        hex      <= 32'h00000000;
+        raw0     <= 32'hFFFFFFFF;
+        raw1     <= 32'hFFFFFFFF;
+        wb_ack_o <= 1'b0;
+        wb_dat_o <= 32'h00000000;
+    end
+    else begin
+        wb_ack_o <= req;
+        if(req & wb_we_i) begin
+            case(reg_idx)
+            2'd0:    ctrl <= merge(ctrl, wb_dat_i, wb_sel_i) & 32'h00FFFF07;
+            2'd1:    hex  <= merge(hex, wb_dat_i, wb_sel_i);
+            2'd2:    raw0 <= merge(raw0, wb_dat_i, wb_sel_i);
+            default: raw1 <= merge(raw1, wb_dat_i, wb_sel_i);
+            endcase
+        end
+        if(req) begin
+            case(reg_idx)
+            2'd0:    wb_dat_o <= ctrl;
+            2'd1:    wb_dat_o <= hex;
+            2'd2:    wb_dat_o <= raw0;
+            default: wb_dat_o <= raw1;
+            endcase
+        end
+    end
+end
+
+// 动态扫描：轮流点亮每一位
+reg [SCAN_DIV_LOG2 - 1:0] scan_cnt;
+reg [2:0]                 digit;
+
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        scan_cnt <= {SCAN_DIV_LOG2{1'b0}};
+        digit    <= 3'd0;
+    end
+    else begin
+        scan_cnt <= scan_cnt + 1'b1;
+        if(&scan_cnt) begin
+            digit <= digit + 3'd1;
+        end
+    end
+end
+
+// 高位的 0：第 d 位及以上的数字全为 0
+wire [7:0] lead_zero;
+assign lead_zero[0] = 1'b0;
+assign lead_zero[1] = (hex[31:4]  == 28'h0);
+assign lead_zero[2] = (hex[31:8]  == 24'h0);
+assign lead_zero[3] = (hex[31:12] == 20'h0);
+assign lead_zero[4] = (hex[31:16] == 16'h0);
+assign lead_zero[5] = (hex[31:20] == 12'h0);
+assign lead_zero[6] = (hex[31:24] == 8'h0);
+assign lead_zero[7] = (hex[31:28] == 4'h0);
+
+wire [3:0] cur_hex = hex[{digit, 2'b00} +: 4];
+wire [7:0] cur_raw = digit[2] ? raw1[{digit[1:0], 3'b000} +: 8] : raw0[{digit[1:0], 3'b000} +: 8];
+
+// 输出打一拍，避免译码的毛刺出现在引脚上
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        seg_o <= 8'hFF;
+        sel_o <= 8'hFF;
+    end
+    else begin
+        if(ctrl[16 + digit] | (~ctrl[1] & ctrl[2] & lead_zero[digit])) begin
+            seg_o <= 8'hFF;
+        end
+        else if(ctrl[1]) begin
+            seg_o <= cur_raw;
+        end
+        else begin
+            seg_o <= {~ctrl[8 + digit], hex2seg(cur_hex)};
+        end
+        sel_o <= ~(8'h01 << digit);
+    end
+end
+
+endmodule
@@ -0,0 +1,635 @@
+`timescale 1ns / 1ps
+
+// DDR2 控制器（Wishbone 包装部分）的仿真测试平台
+// 只编译 DDR2.v 和本文件：下面的 clk_wiz_0、Ram2Ddr 是代替时钟 IP 和 Ram2Ddr（含 MIG）的简化模型，
+// Ram2Ddr 模型的状态机、请求/完成握手和两级同步与 Ram2Ddr.vhd 相同，MIG 只用固定的读延迟代替
+// 依次检查：
+//   1. mem_req/mem_done 两相握手：请求未完成时 mem_req 不翻转，命令、地址和写数据保持不变
+//   2. 应答时序：只在 cyc、stb 有效时应答，每个应答只有一个周期，读回的数据正确
+//   3. 读操作等待 DDR2 期间主设备撤销总线周期（rd_abort/ird_abort）：不应答，之后的访问得到正确的数据
+// 并打印两个端口的平均读延迟：从 cyc 有效的第一个时钟沿到看到应答的周期数（100MHz 时钟）
+module tb_ddr2;
+
+reg         clk = 1'b0;
+reg         rst = 1'b1;
+
+// 数据端口
+reg         cyc = 1'b0;
+reg         stb = 1'b0;
+reg         we  = 1'b0;
+reg  [3:0]  sel = 4'b1111;
+reg  [26:0] adr = 27'd0;
+reg  [31:0] wdat = 32'd0;
+wire [31:0] dat;
+wire        ack;
+
+// 指令端口
+reg         icyc = 1'b0;
+reg         istb = 1'b0;
+reg  [26:0] iadr = 27'd0;
+wire [31:0] idat;
+wire        iack;
+
+wire        calib_done;
+wire        wq_empty;
+
+always #5 clk = ~clk;      // 100MHz
+
+DDR2 dut(
+    .wb_clk_i(clk),
+    .wb_rst_i(rst),
+    .wb_cyc_i(cyc),
+    .wb_stb_i(stb),
+    .wb_we_i(we),
+    .wb_sel_i(sel),
+    .wb_adr_i(adr),
+    .wb_dat_i(wdat),
+    .wb_dat_o(dat),
+    .wb_ack_o(ack),
+    .wbi_cyc_i(icyc),
+    .wbi_stb_i(istb),
+    .wbi_adr_i(iadr),
+    .wbi_dat_o(idat),
+    .wbi_ack_o(iack),
+    .init_calib_complete(calib_done),
+    .wq_empty_o(wq_empty),
+    .ddr2_addr(),
+    .ddr2_ba(),
+    .ddr2_ras_n(),
+    .ddr2_cas_n(),
+    .ddr2_we_n(),
+    .ddr2_ck_p(),
+    .ddr2_ck_n(),
+    .ddr2_cke(),
+    .ddr2_cs_n(),
+    .ddr2_dm(),
+    .ddr2_odt(),
+    .ddr2_dq(),
+    .ddr2_dqs_p(),
+    .ddr2_dqs_n()
+);
+
+// 存储器的初始内容，与 Ram2Ddr 模型相同；测试中写过的字记在 shadow 中
+function [31:0] init_word;
+    input [26:0] a;
+    begin
+        init_word = {~a[15:0], a[15:0]};
+    end
+endfunction
+
+reg [31:0] shadow[0:63];        // 0x8000 ~ 0x80FF 中写过的字
+reg [63:0] shadow_valid = 64'd0;
+
+function [31:0] expect_word;
+    input [26:0] a;
+    begin
+        if(a[26:8] == 19'h00080 && shadow_valid[a[7:2]])
+            expect_word = shadow[a[7:2]];
+        else
+            expect_word = init_word({a[26:2], 2'b00});
+    end
+endfunction
+
+integer errors = 0;
+
+// ---------------- 握手与应答时序检查 ----------------
+reg         prev_req  = 1'b0;
+reg         prev_done = 1'b0;
+reg  [26:0] prev_a    = 27'd0;
+reg  [1:0]  prev_ctl  = 2'b11;
+reg  [35:0] prev_wr   = 36'd0;
+reg         prev_ack  = 1'b0;
+reg         prev_iack = 1'b0;
+reg         prev_stb  = 1'b0;       // 上一个时钟沿的 cyc & stb，应答是在那个时钟沿寄存的
+reg         prev_istb = 1'b0;
+
+always @(posedge clk) begin
+    if(!rst) begin
+        // 上一个周期还有请求未完成（mem_done 是 Ram2Ddr 一侧的值，这里只会看晚）
+        if(prev_req != prev_done) begin
+            if(dut.mem_req != prev_req) begin
+                $display("ERROR: mem_req toggled at %0t before the previous request was done", $time);
+                errors = errors + 1;
+            end
+            if(dut.mem_a != prev_a || {dut.mem_wen, dut.mem_oen} != prev_ctl ||
+               (!dut.mem_wen && {dut.mem_sel, dut.mem_dq_i} != prev_wr)) begin
+                $display("ERROR: command changed at %0t while a request was outstanding", $time);
+                errors = errors + 1;
+            end
+        end
+        // 主设备可能在应答寄存的同一个时钟沿撤销总线周期，这时的应答不算错
+        if(ack && !prev_stb) begin
+            $display("ERROR: data port ack at %0t without cyc/stb", $time);
+            errors = errors + 1;
+        end
+        if(iack && !prev_istb) begin
+            $display("ERROR: instruction port ack at %0t without cyc/stb", $time);
+            errors = errors + 1;
+        end
+        if((ack && prev_ack) || (iack && prev_iack)) begin
+            $display("ERROR: ack held for more than one cycle at %0t", $time);
+            errors = errors + 1;
+        end
+    end
+    prev_stb  <= cyc & stb;
+    prev_istb <= icyc & istb;
+    prev_req  <= dut.mem_req;
+    prev_done <= dut.mem_done;
+    prev_a    <= dut.mem_a;
+    prev_ctl  <= {dut.mem_wen, dut.mem_oen};
+    prev_wr   <= {dut.mem_sel, dut.mem_dq_i};
+    prev_ack  <= ack;
+    prev_iack <= iack;
+end
+
+// ---------------- 数据端口 ----------------
+task rd;
+    input  [26:0] a;
+    output [31:0] n;
+    reg    [31:0] d;
+    begin
+        cyc <= 1'b1;
+        stb <= 1'b1;
+        we  <= 1'b0;
+        adr <= a;
+        n = 0;
+        @(posedge clk);
+        while(!ack) begin
+            @(posedge clk);
+            n = n + 1;
+            if(n > 2000) begin
+                $display("ERROR: no data port ack for %h", a);
+                errors = errors + 1;
+                $finish;
+            end
+        end
+        d = dat;
+        if(d !== expect_word(a)) begin
+            $display("ERROR: read %h got %h, expected %h", a, d, expect_word(a));
+            errors = errors + 1;
+        end
+        cyc <= 1'b0;
+        stb <= 1'b0;
+        @(posedge clk);
+    end
+endtask
+
+task wr;
+    input  [26:0] a;
+    input  [31:0] d;
+    input  [3:0]  s;
+    output [31:0] n;
+    reg    [31:0] old;
+    begin
+        cyc  <= 1'b1;
+        stb  <= 1'b1;
+        we   <= 1'b1;
+        adr  <= a;
+        wdat <= d;
+        sel  <= s;
+        n = 0;
+        @(posedge clk);
+        while(!ack) begin
+            @(posedge clk);
+            n = n + 1;
+            if(n > 2000) begin
+                $display("ERROR: no ack for write %h", a);
+                errors = errors + 1;
+                $finish;
+            end
+        end
+        old = expect_word(a);
+        shadow[a[7:2]] = {s[3] ? d[31:24] : old[31:24], s[2] ? d[23:16] : old[23:16],
+                          s[1] ? d[15:8]  : old[15:8],  s[0] ? d[7:0]   : old[7:0]};
+        shadow_valid[a[7:2]] = 1'b1;
+        cyc  <= 1'b0;
+        stb  <= 1'b0;
+        we   <= 1'b0;
+        sel  <= 4'b1111;
+        @(posedge clk);
+    end
+endtask
+
+// 发起读操作，n 个周期后撤销总线周期，不等待应答
+task rd_abort;
+    input [26:0] a;
+    input [31:0] n;
+    begin
+        cyc <= 1'b1;
+        stb <= 1'b1;
+        we  <= 1'b0;
+        adr <= a;
+        repeat(n) @(posedge clk);
+        if(ack) begin
+            $display("ERROR: read %h was acked before the abort", a);
+            errors = errors + 1;
+        end
+        cyc <= 1'b0;
+        stb <= 1'b0;
+        @(posedge clk);
+    end
+endtask
+
+// ---------------- 指令端口 ----------------
+task ird;
+    input  [26:0] a;
+    output [31:0] n;
+    reg    [31:0] d;
+    begin
+        icyc <= 1'b1;
+        istb <= 1'b1;
+        iadr <= a;
+        n = 0;
+        @(posedge clk);
+        while(!iack) begin
+            @(posedge clk);
+            n = n + 1;
+            if(n > 2000) begin
+                $display("ERROR: no instruction port ack for %h", a);
+                errors = errors + 1;
+                $finish;
+            end
+        end
+        d = idat;
+        if(d !== expect_word(a)) begin
+            $display("ERROR: fetch %h got %h, expected %h", a, d, expect_word(a));
+            errors = errors + 1;
+        end
+        icyc <= 1'b0;
+        istb <= 1'b0;
+        @(posedge clk);
+    end
+endtask
+
+task ird_abort;
+    input [26:0] a;
+    input [31:0] n;
+    begin
+        icyc <= 1'b1;
+        istb <= 1'b1;
+        iadr <= a;
+        repeat(n) @(posedge clk);
+        if(iack) begin
+            $display("ERROR: fetch %h was acked before the abort", a);
+            errors = errors + 1;
+        end
+        icyc <= 1'b0;
+        istb <= 1'b0;
+        @(posedge clk);
+    end
+endtask
+
+// 指令端口在第 5 步与数据端口同时顺序取指
+reg        ifetch_run  = 1'b0;
+reg        ifetch_done = 1'b0;
+integer    isum = 0;
+integer    icnt = 0;
+reg [31:0] ilat;
+integer    k;
+
+initial begin
+    wait(ifetch_run);
+    for(k = 0; k < 64; k = k + 1) begin
+        ird(27'h0020000 + k * 4, ilat);
+        isum = isum + ilat;
+        icnt = icnt + 1;
+    end
+    ifetch_done = 1'b1;
+end
+
+reg [31:0] n;
+integer    i;
+integer    sum;
+integer    nmin;
+integer    nmax;
+
+initial begin
+    repeat(10) @(posedge clk);
+    rst <= 1'b0;
+    wait(calib_done);
+    repeat(10) @(posedge clk);
+
+    // 1. 数据端口：每次都换一行的读操作，全部要访问 DDR2，大多是 DDR2 的行未命中
+    sum = 0; nmin = 10000; nmax = 0;
+    for(i = 0; i < 32; i = i + 1) begin
+        rd(((i * 27'h1a30) & 27'h00fff0) | 27'h0010000 | ((i & 3) << 2), n);
+        sum = sum + n;
+        if(n < nmin) nmin = n;
+        if(n > nmax) nmax = n;
+    end
+    $display("data port read miss: %0d cycles on average (min %0d, max %0d), DDR2 row hits %0d/%0d",
+             sum / 32, nmin, nmax, dut.Ram.row_hits, dut.Ram.requests);
+
+    // 2. 数据端口：顺序读 64 个字，每行的第一个字访问 DDR2（同一行的 DDR2 行命中），其余命中行缓冲
+    sum = 0; nmin = 0; nmax = 0;
+    for(i = 0; i < 64; i = i + 1) begin
+        rd(27'h0030000 + i * 4, n);
+        sum = sum + n;
+        if(i % 4 == 0)
+            nmin = nmin + n;
+        else
+            nmax = nmax + n;
+    end
+    $display("data port sequential read: %0d.%0d cycles per word on average (first word of a line %0d, others %0d)",
+             sum / 64, (sum * 10 / 64) % 10, nmin / 16, nmax / 48);
+
+    // 3. 写操作进入写队列，之后读回（行缓冲更新、写队列转发、等待写入 DDR2 后再读）
+    sum = 0;
+    for(i = 0; i < 8; i = i + 1) begin
+        wr(27'h0008000 + i * 4, 32'hc0de0000 + i, 4'b1111, n);
+        sum = sum + n;
+    end
+    $display("data port write: %0d.%0d cycles to ack on average for 8 back-to-back writes",
+             sum / 8, (sum * 10 / 8) % 10);
+    wr(27'h0008020, 32'h11223344, 4'b0101, n);
+    for(i = 0; i < 9; i = i + 1) begin
+        rd(27'h0008000 + i * 4, n);
+    end
+    wait(wq_empty);
+
+    // 4. 读操作等待 DDR2 期间撤销总线周期
+    // 撤销后读另一行：不能把前一次读回的数据应答给它
+    rd_abort(27'h0040000, 3);
+    rd(27'h0041000, n);
+    rd(27'h0040000, n);
+    // 撤销后立即重读同一个字
+    rd_abort(27'h0042010, 8);
+    rd(27'h0042010, n);
+    // 撤销后写同一行，再读回
+    rd_abort(27'h0008040, 2);
+    wr(27'h0008044, 32'h5555aaaa, 4'b1111, n);
+    rd(27'h0008044, n);
+    rd(27'h0008040, n);
+    // 撤销的时刻正好在 DDR2 完成附近
+    for(i = 0; i < 8; i = i + 1) begin
+        rd_abort(27'h0043000 + i * 16, 20 + i * 2);
+        rd(27'h0044000 + i * 16, n);
+    end
+    // 指令端口
+    ird_abort(27'h0045000, 3);
+    ird(27'h0046000, n);
+    ird(27'h0045000, n);
+    wait(wq_empty);
+
+    // 5. 两个端口同时顺序读
+    ifetch_run = 1'b1;
+    sum = 0;
+    for(i = 0; i < 64; i = i + 1) begin
+        rd(27'h0050000 + i * 4, n);
+        sum = sum + n;
+    end
+    wait(ifetch_done);
+    $display("both ports streaming: data %0d.%0d, instruction %0d.%0d cycles per word on average",
+             sum / 64, (sum * 10 / 64) % 10, isum / icnt, (isum * 10 / icnt) % 10);
+
+    repeat(20) @(posedge clk);
+    if(errors == 0 && dut.Ram.errors == 0)
+        $display("PASS: %0d DDR2 requests", dut.Ram.requests);
+    else
+        $display("FAIL: %0d errors", errors + dut.Ram.errors);
+    $finish;
+end
+
+initial begin
+    #2000000;
+    $display("ERROR: timeout");
+    $finish;
+end
+
+endmodule
+
+
+// clk_wiz_0 的仿真模型：clk_out1 直接使用输入时钟，clk_out2 为 200MHz
+module clk_wiz_0(
+    input  wire clk_in1,
+    output wire clk_out1,
+    output reg  clk_out2,
+    output wire locked
+);
+
+initial clk_out2 = 1'b0;
+always #2.5 clk_out2 = ~clk_out2;
+
+assign clk_out1 = clk_in1;
+assign locked   = 1'b1;
+
+endmodule
+
+
+// Ram2Ddr 的仿真模型
+// 输入寄存、mem_req 两级同步、状态机和 ram_done 的时序与 Ram2Ddr.vhd 相同。MIG 部分简化为：
+// 命令总是立即被接受，读命令之后固定 RD_HIT（行命中）或 RD_MISS（行未命中）个 ui_clk 周期返回整个突发，
+// 每个 bank 记录打开的行（与 MIG 默认的 ROW_BANK_COLUMN 地址映射相同）；每 REFI 个周期刷新一次，
+// 刷新期间 TRFC 个周期不接受命令并关闭所有行。存储器只模拟 64KB，地址的高位被忽略
+module Ram2Ddr #(
+    parameter UI_HALF = 6.154,  // ui_clk 半周期（ns）：DDR2 325MHz，4:1，ui_clk 为 81.25MHz
+    parameter CALIB   = 50,     // 复位后经过多少个 ui_clk 周期完成初始化校准
+    parameter RD_HIT  = 20,     // 读命令被接受到整个突发返回的 ui_clk 周期数，行命中
+    parameter RD_MISS = 23,     // 行未命中，要先关闭原来的行（tRP）再打开新行（tRCD）
+    parameter REFI    = 634,    // 7.8us
+    parameter TRFC    = 11      // 127.5ns
+)(
+    input  wire         clk_200MHz_i,
+    input  wire         rst_i,
+    input  wire [11:0]  device_temp_i,
+    output wire         init_calib_complete_o,
+    input  wire [26:0]  ram_a,
+    input  wire [31:0]  ram_dq_i,
+    output reg  [31:0]  ram_dq_o,
+    output reg  [127:0] ram_line_o,
+    input  wire         ram_req,
+    output wire         ram_done,
+    input  wire         ram_oen,
+    input  wire         ram_wen,
+    input  wire         ram_ub,
+    input  wire         ram_lb,
+    input  wire [3:0]   ram_sel,
+    output wire [12:0]  ddr2_addr,
+    output wire [2:0]   ddr2_ba,
+    output wire         ddr2_ras_n,
+    output wire         ddr2_cas_n,
+    output wire         ddr2_we_n,
+    output wire         ddr2_ck_p,
+    output wire         ddr2_ck_n,
+    output wire         ddr2_cke,
+    output wire         ddr2_cs_n,
+    output wire [1:0]   ddr2_dm,
+    output wire         ddr2_odt,
+    inout  wire [15:0]  ddr2_dq,
+    inout  wire [1:0]   ddr2_dqs_p,
+    inout  wire [1:0]   ddr2_dqs_n
+);
+
+parameter ST_IDLE    = 3'd0;
+parameter ST_PRESET  = 3'd1;
+parameter ST_SEND    = 3'd2;
+parameter ST_CMD_RD  = 3'd3;
+parameter ST_CMD_WR  = 3'd4;
+parameter ST_WAIT_RD = 3'd5;
+
+reg ui_clk = 1'b0;
+always #UI_HALF ui_clk = ~ui_clk;
+
+reg  [1:0]   sreg = 2'b11;
+wire         ui_rst = sreg[1];
+reg  [7:0]   calib_cnt = 8'd0;
+wire         calib = (calib_cnt == CALIB);
+
+reg  [26:0]  ram_a_int   = 27'd0;
+reg  [31:0]  ram_dq_i_int = 32'd0;
+reg          ram_oen_int = 1'b1;
+reg          ram_wen_int = 1'b1;
+reg  [3:0]   ram_sel_int = 4'b0000;
+reg  [1:0]   ram_req_sreg = 2'b00;
+wire         ram_req_sync = ram_req_sreg[1];
+reg          ram_req_ack  = 1'b0;
+reg          ram_done_int = 1'b0;
+
+reg  [2:0]   cstate = ST_IDLE;
+reg  [26:0]  mem_addr = 27'd0;
+reg  [7:0]   rd_wait = 8'd0;
+reg  [9:0]   refi_cnt = 10'd0;
+reg  [7:0]   rfc_cnt = 8'd0;
+wire         mem_rdy = (rfc_cnt == 0);
+
+reg  [127:0] mem[0:4095];
+reg  [12:0]  open_row[0:7];
+reg  [7:0]   row_open = 8'd0;
+wire [2:0]   bank = mem_addr[13:11];
+wire [12:0]  row  = mem_addr[26:14];
+wire         row_hit = row_open[bank] && (open_row[bank] == row);
+
+integer      requests = 0;
+integer      row_hits = 0;          // 行命中的读操作
+integer      errors = 0;
+integer      m;
+
+// 初始内容与 tb_ddr2 中的 init_word 相同
+function [31:0] init_word;
+    input [26:0] a;
+    begin
+        init_word = {~a[15:0], a[15:0]};
+    end
+endfunction
+
+initial begin
+    for(m = 0; m < 4096; m = m + 1) begin
+        mem[m] = {init_word(m * 16 + 12), init_word(m * 16 + 8), init_word(m * 16 + 4), init_word(m * 16)};
+    end
+end
+
+assign init_calib_complete_o = calib;
+assign ram_done = ram_done_int;
+
+// 输入寄存，mem_req 两级同步
+always @(posedge ui_clk) begin
+    sreg         <= {sreg[0], rst_i};
+    ram_a_int    <= ram_a;
+    ram_dq_i_int <= ram_dq_i;
+    ram_oen_int  <= ram_oen;
+    ram_wen_int  <= ram_wen;
+    ram_sel_int  <= ram_sel;
+    ram_req_sreg <= {ram_req_sreg[0], ram_req};
+end
+
+// 刷新
+always @(posedge ui_clk) begin
+    if(ui_rst) begin
+        refi_cnt <= 10'd0;
+        rfc_cnt  <= 8'd0;
+    end
+    else if(refi_cnt == REFI - 1) begin
+        refi_cnt <= 10'd0;
+        rfc_cnt  <= TRFC;
+    end
+    else begin
+        refi_cnt <= refi_cnt + 10'd1;
+        if(rfc_cnt != 0)
+            rfc_cnt <= rfc_cnt - 8'd1;
+    end
+end
+
+always @(posedge ui_clk) begin
+    if(ui_rst) begin
+        calib_cnt    <= 8'd0;
+        cstate       <= ST_IDLE;
+        ram_req_ack  <= 1'b0;
+        ram_done_int <= 1'b0;
+        row_open     <= 8'd0;
+    end
+    else begin
+        if(!calib)
+            calib_cnt <= calib_cnt + 8'd1;
+        if(rfc_cnt == TRFC)
+            row_open <= 8'd0;
+
+        case(cstate)
+        ST_IDLE:
+        begin
+            if(ram_req_sync != ram_req_ack && calib) begin
+                ram_req_ack <= ram_req_sync;
+                cstate      <= ST_PRESET;
+            end
+        end
+        ST_PRESET:
+        begin
+            mem_addr <= ram_a_int;
+            requests = requests + 1;
+            if(!ram_wen_int)
+                cstate <= ST_SEND;
+            else if(!ram_oen_int)
+                cstate <= ST_CMD_RD;
+            else begin
+                $display("ERROR: Ram2Ddr request with neither ram_wen nor ram_oen at %0t", $time);
+                errors = errors + 1;
+            end
+        end
+        ST_SEND:
+        begin
+            cstate <= ST_CMD_WR;
+        end
+        ST_CMD_WR:
+        begin
+            if(mem_rdy) begin
+                if(!ram_sel_int[0]) mem[mem_addr[15:4]][{mem_addr[3:2], 5'd0}  +: 8] <= ram_dq_i_int[7:0];
+                if(!ram_sel_int[1]) mem[mem_addr[15:4]][{mem_addr[3:2], 5'd8}  +: 8] <= ram_dq_i_int[15:8];
+                if(!ram_sel_int[2]) mem[mem_addr[15:4]][{mem_addr[3:2], 5'd16} +: 8] <= ram_dq_i_int[23:16];
+                if(!ram_sel_int[3]) mem[mem_addr[15:4]][{mem_addr[3:2], 5'd24} +: 8] <= ram_dq_i_int[31:24];
+                open_row[bank] <= row;
+                row_open[bank] <= 1'b1;
+                ram_done_int   <= ram_req_ack;
+                cstate         <= ST_IDLE;
+            end
+        end
+        ST_CMD_RD:
+        begin
+            if(mem_rdy) begin
+                if(row_hit)
+                    row_hits = row_hits + 1;
+                rd_wait        <= (row_hit ? RD_HIT : RD_MISS) - 1;
+                open_row[bank] <= row;
+                row_open[bank] <= 1'b1;
+                cstate         <= ST_WAIT_RD;
+            end
+        end
+        ST_WAIT_RD:
+        begin
+            if(rd_wait == 0) begin
+                ram_line_o   <= mem[mem_addr[15:4]];
+                ram_dq_o     <= mem[mem_addr[15:4]][{mem_addr[3:2], 5'd0} +: 32];
+                ram_done_int <= ram_req_ack;
+                cstate       <= ST_IDLE;
+            end
+            else begin
+                rd_wait <= rd_wait - 8'd1;
+            end
+        end
+        default:
+        begin
+            cstate <= ST_IDLE;
+        end
+        endcase
+    end
+end
+
+endmodule
@@ -0,0 +1,313 @@
+`timescale 1ns / 1ps
+
+// flash_rom 的仿真测试平台
+// 用一个简单的 SPI Flash 行为模型（spi_flash_model）代替板上的 Flash，依次检查：
+//   1. 复位后的第一次访问（包括两次初始化重试）
+//   2. 连续读：顺序地址的多个字，片选保持有效，HOLD -> RESUME 直接接收数据
+//   3. 不连续的地址：HOLD -> CLOSE 拉高片选，再经 IDLE/START 重新发送指令和地址
+//   4. 一个字传输到一半时主设备撤销总线周期，之后再读同一个字和下一个字
+// 每次访问都检查读回的数据，并打印从发起访问到应答的周期数（100MHz 时钟）
+// 总线主设备的时序与 flash_cache 相同：收到应答后撤销总线周期，两个周期后再发起下一次访问
+// flash_rom 的 SCK 经 STARTUPE2 输出，没有顶层端口，模型直接接 dut.sck
+module tb_flash_rom;
+
+reg         clk = 1'b0;
+reg         rst = 1'b1;
+reg         cyc = 1'b0;
+reg         stb = 1'b0;
+reg  [23:0] adr = 24'h000000;
+wire [31:0] dat;
+wire        ack;
+
+wire        cs_n;
+wire        sdo;
+wire        sdi;
+wire        wp_n;
+wire        hld_n;
+
+always #5 clk = ~clk;      // 100MHz
+
+flash_rom dut(
+    .wb_clk_i(clk),
+    .wb_rst_i(rst),
+    .wb_cyc_i(cyc),
+    .wb_stb_i(stb),
+    .wb_we_i(1'b0),
+    .wb_sel_i(4'b1111),
+    .wb_adr_i(adr),
+    .wb_dat_i(32'h00000000),
+    .wb_dat_o(dat),
+    .wb_ack_o(ack),
+    .flash_continue(1'b1),
+    .cs_n(cs_n),
+    .sdi(sdi),
+    .sdo(sdo),
+    .wp_n(wp_n),
+    .hld_n(hld_n)
+);
+
+spi_flash_model flash(
+    .sck(dut.sck),
+    .cs_n(cs_n),
+    .si(sdo),
+    .so(sdi)
+);
+
+// Flash 中的内容：每个字节由地址算出，相邻字节、相邻字都不相同
+function [7:0] flash_byte;
+    input [23:0] a;
+    begin
+        flash_byte = a[7:0] ^ a[15:8] ^ a[23:16] ^ 8'hA5;
+    end
+endfunction
+
+// flash_rom 按大端顺序拼字：第一个读到的字节在 [31:24]
+function [31:0] flash_word;
+    input [23:0] a;
+    begin
+        flash_word = {flash_byte(a), flash_byte(a + 24'd1), flash_byte(a + 24'd2), flash_byte(a + 24'd3)};
+    end
+endfunction
+
+integer errors = 0;
+reg [31:0] rdata;
+reg [31:0] ncyc;
+
+// 发起一次读操作，等到应答，返回数据和从 cyc 有效到应答的周期数
+task wb_read;
+    input  [23:0] a;
+    output [31:0] d;
+    output [31:0] n;
+    begin
+        cyc <= 1'b1;
+        stb <= 1'b1;
+        adr <= a;
+        n = 0;
+        @(posedge clk);
+        while(!ack) begin
+            @(posedge clk);
+            n = n + 1;
+            if(n > 1000) begin
+                $display("ERROR: no ack for %h", a);
+                errors = errors + 1;
+                $finish;
+            end
+        end
+        d = dat;
+        cyc <= 1'b0;
+        stb <= 1'b0;
+        repeat(2) @(posedge clk);
+    end
+endtask
+
+// 发起一次读操作，n 个周期后撤销总线周期，不等待应答
+task wb_abort;
+    input [23:0] a;
+    input [31:0] n;
+    begin
+        cyc <= 1'b1;
+        stb <= 1'b1;
+        adr <= a;
+        repeat(n) @(posedge clk);
+        if(ack) begin
+            $display("ERROR: abort at %0d cycles came too late, %h was already acked", n, a);
+            errors = errors + 1;
+        end
+        cyc <= 1'b0;
+        stb <= 1'b0;
+        repeat(2) @(posedge clk);
+    end
+endtask
+
+task check;
+    input [23:0] a;
+    input [31:0] d;
+    begin
+        if(d !== flash_word(a)) begin
+            $display("ERROR: read %h got %h, expected %h", a, d, flash_word(a));
+            errors = errors + 1;
+        end
+    end
+endtask
+
+integer i;
+integer j;
+integer sum;
+time    t0;
+
+initial begin
+    repeat(10) @(posedge clk);
+    rst <= 1'b0;
+    repeat(10) @(posedge clk);
+
+    // 1. 复位后的第一次访问
+    wb_read(24'h000000, rdata, ncyc);
+    check(24'h000000, rdata);
+    $display("first access after reset (2 init retries): %0d cycles", ncyc);
+
+    // 2. 连续读 16 个字，相当于 flash_cache 顺序填充 4 行
+    sum = 0;
+    t0  = $time;
+    for(i = 1; i <= 16; i = i + 1) begin
+        wb_read(i * 4, rdata, ncyc);
+        check(i * 4, rdata);
+        sum = sum + ncyc;
+    end
+    $display("sequential word: %0d cycles to ack on average, %0d ns per word including the bus gap",
+             sum / 16, ($time - t0) / 16);
+
+    // 3. 不连续的地址，经 CLOSE 重新发送指令和地址
+    wb_read(24'h012340, rdata, ncyc);
+    check(24'h012340, rdata);
+    $display("non-sequential word: %0d cycles", ncyc);
+    wb_read(24'h012344, rdata, ncyc);
+    check(24'h012344, rdata);
+    wb_read(24'h012348, rdata, ncyc);
+    check(24'h012348, rdata);
+    $display("sequential word after the new address: %0d cycles", ncyc);
+
+    // 不连续地址中的第一个字就在 HOLD 中
+    wb_read(24'h000400, rdata, ncyc);
+    check(24'h000400, rdata);
+
+    // 4. 在一个字的不同位置撤销总线周期（第一次还在 HOLD 中），之后重读这个字和下一个字
+    for(i = 0; i < 6; i = i + 1) begin
+        j = 24'h000404 + i * 8;
+        wb_abort(j, 1 + i * 12);
+        wb_read(j, rdata, ncyc);
+        check(j, rdata);
+        wb_read(j + 4, rdata, ncyc);
+        check(j + 4, rdata);
+    end
+    // 撤销后换一个地址
+    wb_abort(24'h000500, 30);
+    wb_read(24'h000600, rdata, ncyc);
+    check(24'h000600, rdata);
+    wb_read(24'h000604, rdata, ncyc);
+    check(24'h000604, rdata);
+
+    if(errors == 0 && flash.errors == 0)
+        $display("PASS: %0d flash selects", flash.starts);
+    else
+        $display("FAIL: %0d errors", errors + flash.errors);
+    $finish;
+end
+
+endmodule
+
+
+// SPI Flash 行为模型，只实现 READ（0x03）和 FAST_READ（0x0B），SPI 模式 0：
+// SCK 上升沿采样 si，下降沿之后 T_V 输出下一个比特。片选无效期间输出 0
+// T_V 代表 SCK 翻转到 sdi 在 FPGA 端变化的总延迟，包括 STARTUPE2 到 CCLK 引脚的延迟、
+// Flash 的 tV 和走线。flash_rom 的采样时刻按这个延迟在 10~20ns（1~2 个时钟周期）之间设计，
+// 小于一个时钟周期时读回的每个字节都会错一位
+// 同时检查片选下降时 SCK 为低、两次访问之间片选无效的时间不少于 T_CSH
+module spi_flash_model #(
+    parameter T_V   = 14,       // SCK 下降沿到 sdi 变化的延迟（ns）
+    parameter T_CSH = 50        // 片选无效的最短时间（ns）
+)(
+    input  wire sck,
+    input  wire cs_n,
+    input  wire si,
+    output reg  so
+);
+
+parameter P_CMD    = 3'd0;
+parameter P_ADDR   = 3'd1;
+parameter P_DUMMY  = 3'd2;
+parameter P_DATA   = 3'd3;
+parameter P_IGNORE = 3'd4;      // 不支持的指令，忽略到片选拉高
+
+reg [2:0]  phase    = P_IGNORE;
+reg [7:0]  cmd      = 8'h00;
+reg [23:0] addr     = 24'h000000;
+reg [7:0]  shift    = 8'h00;
+reg [5:0]  bit_cnt  = 6'd0;     // 当前阶段已经收到的比特数
+reg [2:0]  out_bit  = 3'd7;     // 下一个输出的比特
+reg [7:0]  out_byte = 8'h00;
+time       t_cs_high = 0;
+integer    starts = 0;          // 片选有效的次数
+integer    errors = 0;
+
+initial so = 1'b0;
+
+function [7:0] flash_byte;
+    input [23:0] a;
+    begin
+        flash_byte = a[7:0] ^ a[15:8] ^ a[23:16] ^ 8'hA5;
+    end
+endfunction
+
+always @(negedge cs_n) begin
+    if(sck != 1'b0) begin
+        $display("ERROR: flash selected with SCK high at %0t", $time);
+        errors = errors + 1;
+    end
+    if(starts != 0 && $time - t_cs_high < T_CSH) begin
+        $display("ERROR: cs_n high for only %0t ns at %0t", $time - t_cs_high, $time);
+        errors = errors + 1;
+    end
+    starts  = starts + 1;
+    phase   = P_CMD;
+    bit_cnt = 6'd0;
+end
+
+always @(posedge cs_n) begin
+    t_cs_high = $time;
+    phase     = P_IGNORE;
+    so        = 1'b0;
+end
+
+always @(posedge sck) begin
+    if(!cs_n) begin
+        shift   = {shift[6:0], si};
+        bit_cnt = bit_cnt + 6'd1;
+        case(phase)
+        P_CMD:
+        begin
+            if(bit_cnt == 6'd8) begin
+                cmd     = shift;
+                bit_cnt = 6'd0;
+                phase   = (shift == 8'h03 || shift == 8'h0B) ? P_ADDR : P_IGNORE;
+            end
+        end
+        P_ADDR:
+        begin
+            addr = {addr[22:0], si};
+            if(bit_cnt == 6'd24) begin
+                bit_cnt = 6'd0;
+                out_bit = 3'd7;
+                phase   = (cmd == 8'h0B) ? P_DUMMY : P_DATA;
+            end
+        end
+        P_DUMMY:
+        begin
+            if(bit_cnt == 6'd8) begin
+                bit_cnt = 6'd0;
+                phase   = P_DATA;
+            end
+        end
+        default:
+        begin
+            bit_cnt = 6'd0;
+        end
+        endcase
+    end
+end
+
+// 数据阶段每个下降沿输出一个比特，一个字节输出完地址自动加 1
+always @(negedge sck) begin
+    if(!cs_n && phase == P_DATA) begin
+        out_byte = flash_byte(addr);
+        so <= #T_V out_byte[out_bit];
+        if(out_bit == 3'd0) begin
+            out_bit = 3'd7;
+            addr    = addr + 24'd1;
+        end
+        else begin
+            out_bit = out_bit - 3'd1;
+        end
+    end
+end
+
+endmodule
@@ -15,7 +15,7 @@
 ////  16550D uart (mostly supported)                              ////
 ////                                                              ////
 ////  Overview (main Features):                                   ////
-////  Inferrable Distributed RAM for FIFOs                        ////
+////  Inferrable Block RAM for FIFOs                              ////
 ////                                                              ////
 ////  Known problems (limits):                                    ////
 ////  None                .                                       ////
@@ -79,7 +79,13 @@
 //  It's disabled by default. Define UART_HAS_BAUDRATE_OUTPUT to use.
 //
 
-//Following is the Verilog code for a dual-port RAM with asynchronous read. 
+//Dual-port RAM with a registered read port, so that deep FIFOs are
+//inferred as block RAM instead of distributed RAM.
+//dpra is sampled at the clock edge and dpo gives the word at that address
+//during the next cycle. A write to the same address in the same edge is
+//forwarded to dpo, so a FIFO that drives dpra with the *next* value of its
+//read pointer sees exactly what an asynchronous read of the current read
+//pointer would return.
 module raminfr   
         (clk, we, a, dpra, di, dpo); 
 
@@ -92,10 +98,13 @@ input we;
 input  [addr_width-1:0] a;   
 input  [addr_width-1:0] dpra;   
 input  [data_width-1:0] di;   
-//output [data_width-1:0] spo;   
 output [data_width-1:0] dpo;   
 reg    [data_width-1:0] ram [depth-1:0]; 
 
+reg    [data_width-1:0] ram_q;
+reg    [data_width-1:0] di_q;
+reg                     bypass;
+
 wire [data_width-1:0] dpo;
 wire  [data_width-1:0] di;   
 wire  [addr_width-1:0] a;   
@@ -104,8 +113,9 @@ wire  [addr_width-1:0] dpra;
   always @(posedge clk) begin   
     if (we)   
       ram[a] <= di;   
+    ram_q  <= ram[dpra];
+    di_q   <= di;
+    bypass <= we && (a == dpra);
   end   
-//  assign spo = ram[a];   
-  assign dpo = ram[dpra];   
+  assign dpo = bypass ? di_q : ram_q;   
 endmodule 
-
@@ -112,13 +112,17 @@ input [3:0] 							rstate;
 wire [`UART_ADDR_WIDTH-1:0] 		wb_adr_i;
 reg [31:0] 								wb_dat32_o;
 
+// the debug register keeps its 5 bit count fields; deeper FIFOs saturate at 31
+wire [4:0] rf_count5 = (rf_count > 31) ? 5'd31 : rf_count[4:0];
+wire [4:0] tf_count5 = (tf_count > 31) ? 5'd31 : tf_count[4:0];
+
 always @(/*AUTOSENSE*/fcr or ier or iir or lcr or lsr or mcr or msr
-			or rf_count or rstate or tf_count or tstate or wb_adr_i)
+			or rf_count5 or rstate or tf_count5 or tstate or wb_adr_i)
 	case (wb_adr_i)
 		                      // 8 + 8 + 4 + 4 + 8
 		5'b01000: wb_dat32_o = {msr,lcr,iir,ier,lsr};
 		               // 5 + 2 + 5 + 4 + 5 + 3
-		5'b01100: wb_dat32_o = {8'b0, fcr,mcr, rf_count, rstate, tf_count, tstate};
+		5'b01100: wb_dat32_o = {8'b0, fcr,mcr, rf_count5, rstate, tf_count5, tstate};
 		default: wb_dat32_o = 0;
 	endcase // case(wb_adr_i)
 
@@ -228,9 +228,15 @@
 // FIFO parameter defines
 
 `define UART_FIFO_WIDTH	8
-`define UART_FIFO_DEPTH	16
-`define UART_FIFO_POINTER_W	4
-`define UART_FIFO_COUNTER_W	5
+// FIFO depths are powers of 2 given by their pointer widths: 4 gives the
+// 16 entries of a real 16550, 10 gives 1 KB and 12 gives 4 KB. The FIFO
+// memories have a registered read port and map to block RAM when deep.
+`define UART_TX_FIFO_POINTER_W	10
+`define UART_RX_FIFO_POINTER_W	10
+`define UART_TX_FIFO_DEPTH	(1 << `UART_TX_FIFO_POINTER_W)
+`define UART_RX_FIFO_DEPTH	(1 << `UART_RX_FIFO_POINTER_W)
+// counters are shared by both FIFOs and sized for the deeper one
+`define UART_FIFO_COUNTER_W	(((`UART_TX_FIFO_POINTER_W > `UART_RX_FIFO_POINTER_W) ? `UART_TX_FIFO_POINTER_W : `UART_RX_FIFO_POINTER_W) + 1)
 // receiver fifo has width 11 because it has break, parity and framing error bits
 `define UART_FIFO_REC_WIDTH  11
 
@@ -240,7 +240,9 @@ module uart_regs (clk,
 // debug interface signals	enabled
 ier, iir, fcr, mcr, lcr, msr, lsr, rf_count, tf_count, tstate, rstate,
 `endif				
-	rts_pad_o, dtr_pad_o, int_o
+	rts_pad_o, dtr_pad_o, int_o,
+// DMA handshake
+	tx_dreq_o, rx_dreq_o, tx_dack_i, rx_dack_i
 `ifdef UART_HAS_BAUDRATE_OUTPUT
 	, baud_o
 `endif
@@ -262,6 +264,10 @@ input [3:0] 							modem_inputs;
 output 									rts_pad_o;
 output 									dtr_pad_o;
 output 									int_o;
+output 									tx_dreq_o;	// DMA may write one character to THR
+output 									rx_dreq_o;	// DMA may read one character from RBR
+input 									tx_dack_i;	// DMA finished a THR write
+input 									rx_dack_i;	// DMA finished an RBR read
 `ifdef UART_HAS_BAUDRATE_OUTPUT
 output	baud_o;
 `endif
@@ -742,6 +748,18 @@ end // always of break condition detection
 assign thre_set_en = ~(|block_cnt);
 
 
+//
+//	DMA REQUEST LOGIC
+//
+// A request means that one more character can be moved without overrunning
+// the TX FIFO or reading an empty RX FIFO. The FIFO counters change a cycle
+// or two after the WISHBONE access has been acknowledged, so the request is
+// held off while the DMA engine signals the end of a transfer on dack; the
+// engine samples the request again no earlier than that. Nothing is
+// requested while the divisor latches are mapped over THR/RBR.
+assign tx_dreq_o = ~dlab && (tf_count < `UART_TX_FIFO_DEPTH) && ~tx_dack_i;
+assign rx_dreq_o = ~dlab && (|rf_count) && ~rf_pop && ~rx_dack_i;
+
 //
 //	INTERRUPT LOGIC
 //
@@ -163,8 +163,8 @@ module uart_rfifo (clk,
 
 // FIFO parameters
 parameter fifo_width = `UART_FIFO_WIDTH;
-parameter fifo_depth = `UART_FIFO_DEPTH;
-parameter fifo_pointer_w = `UART_FIFO_POINTER_W;
+parameter fifo_depth = `UART_RX_FIFO_DEPTH;
+parameter fifo_pointer_w = `UART_RX_FIFO_POINTER_W;
 parameter fifo_counter_w = `UART_FIFO_COUNTER_W;
 
 input				clk;
@@ -181,9 +181,7 @@ output	[fifo_counter_w-1:0]	count;
 output				error_bit;
 
 wire	[fifo_width-1:0]	data_out;
-wire [7:0] data8_out;
-// flags FIFO
-reg	[2:0]	fifo[fifo_depth-1:0];
+wire	[fifo_width-1:0]	ram_out;
 
 // FIFO pointers
 reg	[fifo_pointer_w-1:0]	top;
@@ -191,16 +189,29 @@ reg	[fifo_pointer_w-1:0]	bottom;
 
 reg	[fifo_counter_w-1:0]	count;
 reg				overrun;
+// number of characters in the fifo with a break, parity or framing error
+reg	[fifo_counter_w-1:0]	error_count;
 
 wire [fifo_pointer_w-1:0] top_plus_1 = top + 1'b1;
 
-raminfr #(fifo_pointer_w,8,fifo_depth) rfifo  
+// The error flags used to live in a register array that was cleared entry by
+// entry and ORed together for LSR bit 7, which does not scale to deep FIFOs.
+// They are now stored in the RAM next to the character and error_count
+// keeps track of how many stored characters carry an error.
+// As in uart_tfifo, the registered RAM read port is addressed with the next
+// value of bottom and a push into a full FIFO is dropped.
+wire	fifo_pop = pop & (push | (count != 0));
+wire	fifo_we  = push & (pop | (count < fifo_depth));
+wire [fifo_pointer_w-1:0] bottom_next = fifo_reset ? {fifo_pointer_w{1'b0}} :
+                                        fifo_pop   ? bottom + 1'b1 : bottom;
+
+raminfr #(fifo_pointer_w,fifo_width,fifo_depth) rfifo  
         (.clk(clk), 
-			.we(push), 
+			.we(fifo_we), 
 			.a(top), 
-			.dpra(bottom), 
-			.di(data_in[fifo_width-1:fifo_width-8]), 
-			.dpo(data8_out)
+			.dpra(bottom_next), 
+			.di(data_in), 
+			.dpo(ram_out)
 		); 
 
 always @(posedge clk or posedge wb_rst_i) // synchronous FIFO
@@ -210,44 +221,12 @@ begin
 		top		<= #1 0;
 		bottom		<= #1 1'b0;
 		count		<= #1 0;
-		fifo[0] <= #1 0;
-		fifo[1] <= #1 0;
-		fifo[2] <= #1 0;
-		fifo[3] <= #1 0;
-		fifo[4] <= #1 0;
-		fifo[5] <= #1 0;
-		fifo[6] <= #1 0;
-		fifo[7] <= #1 0;
-		fifo[8] <= #1 0;
-		fifo[9] <= #1 0;
-		fifo[10] <= #1 0;
-		fifo[11] <= #1 0;
-		fifo[12] <= #1 0;
-		fifo[13] <= #1 0;
-		fifo[14] <= #1 0;
-		fifo[15] <= #1 0;
 	end
 	else
 	if (fifo_reset) begin
 		top		<= #1 0;
 		bottom		<= #1 1'b0;
 		count		<= #1 0;
-		fifo[0] <= #1 0;
-		fifo[1] <= #1 0;
-		fifo[2] <= #1 0;
-		fifo[3] <= #1 0;
-		fifo[4] <= #1 0;
-		fifo[5] <= #1 0;
-		fifo[6] <= #1 0;
-		fifo[7] <= #1 0;
-		fifo[8] <= #1 0;
-		fifo[9] <= #1 0;
-		fifo[10] <= #1 0;
-		fifo[11] <= #1 0;
-		fifo[12] <= #1 0;
-		fifo[13] <= #1 0;
-		fifo[14] <= #1 0;
-		fifo[15] <= #1 0;
 	end
   else
 	begin
@@ -255,19 +234,16 @@ begin
 		2'b10 : if (count<fifo_depth)  // overrun condition
 			begin
 				top       <= #1 top_plus_1;
-				fifo[top] <= #1 data_in[2:0];
 				count     <= #1 count + 1'b1;
 			end
 		2'b01 : if(count>0)
 			begin
-        fifo[bottom] <= #1 0;
 				bottom   <= #1 bottom + 1'b1;
 				count	 <= #1 count - 1'b1;
 			end
 		2'b11 : begin
 				bottom   <= #1 bottom + 1'b1;
 				top       <= #1 top_plus_1;
-				fifo[top] <= #1 data_in[2:0];
 		        end
     default: ;
 		endcase
@@ -288,33 +264,34 @@ end   // always
 
 
 // please note though that data_out is only valid one clock after pop signal
-assign data_out = {data8_out,fifo[bottom]};
+// the error flags of an empty fifo read as 0, as they did when the flag
+// array was cleared on pop
+assign data_out = {ram_out[fifo_width-1:3], (count != 0) ? ram_out[2:0] : 3'b000};
 
 // Additional logic for detection of error conditions (parity and framing) inside the FIFO
 // for the Line Status Register bit 7
 
-wire	[2:0]	word0 = fifo[0];
-wire	[2:0]	word1 = fifo[1];
-wire	[2:0]	word2 = fifo[2];
-wire	[2:0]	word3 = fifo[3];
-wire	[2:0]	word4 = fifo[4];
-wire	[2:0]	word5 = fifo[5];
-wire	[2:0]	word6 = fifo[6];
-wire	[2:0]	word7 = fifo[7];
+// a push into an empty fifo together with a pop moves both pointers past
+// the character, so it never becomes readable and is not counted
+wire	error_in  = fifo_we & (|data_in[2:0]) & ~(pop & (count == 0));
+wire	error_out = fifo_pop & (|data_out[2:0]);
 
-wire	[2:0]	word8 = fifo[8];
-wire	[2:0]	word9 = fifo[9];
-wire	[2:0]	word10 = fifo[10];
-wire	[2:0]	word11 = fifo[11];
-wire	[2:0]	word12 = fifo[12];
-wire	[2:0]	word13 = fifo[13];
-wire	[2:0]	word14 = fifo[14];
-wire	[2:0]	word15 = fifo[15];
+always @(posedge clk or posedge wb_rst_i)
+begin
+  if (wb_rst_i)
+    error_count <= #1 0;
+  else
+  if (fifo_reset)
+    error_count <= #1 0;
+  else
+  case ({error_in, error_out})
+  2'b10 : error_count <= #1 error_count + 1'b1;
+  2'b01 : error_count <= #1 error_count - 1'b1;
+  default: ;
+  endcase
+end   // always
 
 // a 1 is returned if any of the error bits in the fifo is 1
-assign	error_bit = |(word0[2:0]  | word1[2:0]  | word2[2:0]  | word3[2:0]  |
-            		      word4[2:0]  | word5[2:0]  | word6[2:0]  | word7[2:0]  |
-            		      word8[2:0]  | word9[2:0]  | word10[2:0] | word11[2:0] |
-            		      word12[2:0] | word13[2:0] | word14[2:0] | word15[2:0] );
+assign	error_bit = |error_count;
 
 endmodule
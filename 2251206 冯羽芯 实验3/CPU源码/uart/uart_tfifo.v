@@ -156,8 +156,8 @@ module uart_tfifo (clk,
 
 // FIFO parameters
 parameter fifo_width = `UART_FIFO_WIDTH;
-parameter fifo_depth = `UART_FIFO_DEPTH;
-parameter fifo_pointer_w = `UART_FIFO_POINTER_W;
+parameter fifo_depth = `UART_TX_FIFO_DEPTH;
+parameter fifo_pointer_w = `UART_TX_FIFO_POINTER_W;
 parameter fifo_counter_w = `UART_FIFO_COUNTER_W;
 
 input				clk;
@@ -182,11 +182,18 @@ reg	[fifo_counter_w-1:0]	count;
 reg				overrun;
 wire [fifo_pointer_w-1:0] top_plus_1 = top + 1'b1;
 
+// the RAM read port is registered, so it is addressed with the value bottom
+// will have after this clock edge; a push into a full FIFO is dropped
+wire	fifo_pop = pop & (push | (count != 0));
+wire	fifo_we  = push & (pop | (count < fifo_depth));
+wire [fifo_pointer_w-1:0] bottom_next = fifo_reset ? {fifo_pointer_w{1'b0}} :
+                                        fifo_pop   ? bottom + 1'b1 : bottom;
+
 raminfr #(fifo_pointer_w,fifo_width,fifo_depth) tfifo  
         (.clk(clk), 
-			.we(push), 
+			.we(fifo_we), 
 			.a(top), 
-			.dpra(bottom), 
+			.dpra(bottom_next), 
 			.di(data_in), 
 			.dpo(data_out)
 		); 
@@ -149,7 +149,10 @@ module uart_top	(
 	stx_pad_o, srx_pad_i,
 
 	// modem signals
-	rts_pad_o, cts_pad_i, dtr_pad_o, dsr_pad_i, ri_pad_i, dcd_pad_i
+	rts_pad_o, cts_pad_i, dtr_pad_o, dsr_pad_i, ri_pad_i, dcd_pad_i,
+
+	// DMA handshake
+	tx_dreq_o, rx_dreq_o, tx_dack_i, rx_dack_i
 `ifdef UART_HAS_BAUDRATE_OUTPUT
 	, baud_o
 `endif
@@ -172,6 +175,12 @@ input [3:0]							 wb_sel_i;
 output 								 wb_ack_o;
 output 								 int_o;
 
+// DMA handshake
+output 								 tx_dreq_o;
+output 								 rx_dreq_o;
+input 								 tx_dack_i;
+input 								 rx_dack_i;
+
 // UART	signals
 input 								 srx_pad_i;
 output 								 stx_pad_o;
@@ -294,7 +303,11 @@ uart_regs	regs(
 `endif					  
 	.rts_pad_o(		rts_pad_o		),
 	.dtr_pad_o(		dtr_pad_o		),
-	.int_o(		int_o		)
+	.int_o(		int_o		),
+	.tx_dreq_o(	tx_dreq_o	),
+	.rx_dreq_o(	rx_dreq_o	),
+	.tx_dack_i(	tx_dack_i	),
+	.rx_dack_i(	rx_dack_i	)
 `ifdef UART_HAS_BAUDRATE_OUTPUT
 	, .baud_o(baud_o)
 `endif
@@ -0,0 +1,115 @@
+`timescale 1ns / 1ps
+
+// CRC 计算单元：挂在总线互联的从设备接口 10（0xA0000000），每写一个字处理其中选中的
+// 字节，一个周期最多处理 4 个字节。数据窗口覆盖 0x10 以上的整个地址空间，DMA 用存储器
+// 到存储器模式（目的地址递增）就能把一段存储器全速送进来，不需要查询状态
+//
+// 寄存器（都按字访问）：
+//   0x00 CTRL    [0] CRC16 为 1 时计算 CRC-16/MODBUS，为 0 时计算 CRC-32（与 zlib 相同）
+//                写 [1] INIT 为 1 时把 STATE 设为 INIT 寄存器的值
+//   0x04 INIT    STATE 的初值，复位后为 0xFFFFFFFF，CRC-16 只用低 16 位
+//   0x08 STATE   当前的移位寄存器，可以读写，用于保存、恢复一次未完成的计算
+//   0x0C RESULT  只读，CRC-32 为 STATE 取反，CRC-16 为 STATE 的低 16 位
+//   0x10 以上    DATA，写入的字按地址从低到高（大端，[31:24] 在前）的顺序处理，
+//                只处理 wb_sel_i 选中的字节；读出为 0
+// 两种 CRC 都是反射的：每个字节从最低位开始移入，多项式分别为 0xEDB88320、0xA001
+module wb_crc(
+    // Wishbone 总线接口
+    input wire        wb_clk_i,        // Wishbone 时钟
+    input wire        wb_rst_i,        // Wishbone 复位
+    input wire        wb_cyc_i,        // Wishbone 总线周期有效
+    input wire        wb_stb_i,        // Wishbone 选通信号
+    input wire        wb_we_i,         // Wishbone 写使能
+    input wire [3:0]  wb_sel_i,        // Wishbone 字节选择
+    input wire [31:0] wb_adr_i,        // Wishbone 地址
+    input wire [31:0] wb_dat_i,        // Wishbone 写数据
+    output reg [31:0] wb_dat_o,        // Wishbone 读数据
+    output reg        wb_ack_o         // Wishbone 应答
+    );
+
+reg         crc16;
+reg [31:0]  init;
+reg [31:0]  state;
+
+// 把一个字节移入 CRC，反射算法，CRC-16 时高 16 位保持为 0
+function [31:0] crc_byte;
+    input [31:0] c;
+    input [7:0]  d;
+    input        m16;
+    integer      k;
+    reg [31:0]   r;
+    begin
+        r = c;
+        for(k = 0; k < 8; k = k + 1) begin
+            if(r[0] ^ d[k]) begin
+                r = (r >> 1) ^ (m16 ? 32'h0000A001 : 32'hEDB88320);
+            end
+            else begin
+                r = r >> 1;
+            end
+        end
+        crc_byte = r;
+    end
+endfunction
+
+// 一个字中选中的字节依次移入，地址低的字节（[31:24]）先移入
+reg [31:0]  next_state;
+always @ (*) begin
+    next_state = state;
+    if(wb_sel_i[3]) next_state = crc_byte(next_state, wb_dat_i[31:24], crc16);
+    if(wb_sel_i[2]) next_state = crc_byte(next_state, wb_dat_i[23:16], crc16);
+    if(wb_sel_i[1]) next_state = crc_byte(next_state, wb_dat_i[15:8],  crc16);
+    if(wb_sel_i[0]) next_state = crc_byte(next_state, wb_dat_i[7:0],   crc16);
+end
+
+wire        req      = wb_cyc_i & wb_stb_i & ~wb_ack_o;
+wire        data_sel = (wb_adr_i[27:4] != 24'h000000);
+wire [1:0]  reg_idx  = wb_adr_i[3:2];
+
+// 寄存器访问，应答只保持一个周期
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        crc16    <= 1'b0;
+        init     <= 32'hFFFFFFFF;
+        state    <= 32'hFFFFFFFF;
+        wb_ack_o <= 1'b0;
+        wb_dat_o <= 32'h00000000;
+    end
+    else begin
+        wb_ack_o <= req;
+        if(req & wb_we_i) begin
+            if(data_sel) begin
+                state <= next_state;
+            end
+            else begin
+                case(reg_idx)
+                2'd0:
+                begin
+                    crc16 <= wb_dat_i[0];
+                    if(wb_dat_i[1]) begin
+                        state <= wb_dat_i[0] ? {16'h0000, init[15:0]} : init;
+                    end
+                end
+                2'd1:    init  <= wb_dat_i;
+                2'd2:    state <= wb_dat_i;
+                default: ;
+                endcase
+            end
+        end
+        if(req) begin
+            if(data_sel) begin
+                wb_dat_o <= 32'h00000000;
+            end
+            else begin
+                case(reg_idx)
+                2'd0:    wb_dat_o <= {31'h00000000, crc16};
+                2'd1:    wb_dat_o <= init;
+                2'd2:    wb_dat_o <= state;
+                default: wb_dat_o <= crc16 ? {16'h0000, state[15:0]} : ~state;
+                endcase
+            end
+        end
+    end
+end
+
+endmodule
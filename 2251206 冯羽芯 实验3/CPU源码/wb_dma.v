@@ -0,0 +1,326 @@
+`timescale 1ns / 1ps
+
+// 两通道 DMA 控制器：寄存器接口挂在 Wishbone 总线互联矩阵的从设备接口 5（0x50000000），
+// 搬运数据使用主设备接口 2，与处理器的指令、数据总线并列竞争各个从设备
+//
+// 每个通道占 0x20 字节的寄存器空间，通道 n 的基地址为 0x50000000 + n * 0x20：
+//   0x00 CTRL      [0] EN   写 1 启动通道，传输完成后由硬件清零
+//                  [1] IE   完成中断使能
+//                  [3:2]    MODE，00 存储器到存储器，源、目的地址都递增
+//                                 01 存储器到外设，只有源地址递增，目的地址固定
+//                                 10 外设到存储器，只有目的地址递增，源地址固定
+//                  [5:4]    SIZE，每次传输的单位，00 字节、01 半字、10 字
+//                  [6]  HREQ 外设模式下用外设的 DMA 请求线代替查询状态寄存器
+//                  [7]      REQ，HREQ 为 1 时使用的请求线，0 为 UART 发送、1 为 UART 接收
+//   0x04 SRC       源地址
+//   0x08 DST       目的地址
+//   0x0C COUNT     剩余的传输次数（单位个数），随传输递减
+//   0x10 STAT_ADDR 外设状态寄存器的地址（字节地址）
+//   0x14 STAT_MASK 外设状态位掩码，只用低 8 位
+// 全局寄存器：
+//   0x40 INT_STATUS 每个通道一位的完成标志，写 1 清零
+//
+// 外设模式下，每传输一个单位之前先读一次 STAT_ADDR 处的字节，与 STAT_MASK 相与
+// 不为 0 才进行传输，否则让出总线、稍后再查。例如向 UART 发送时查 LSR 的 THRE 位，
+// 从 UART 接收时查 LSR 的 DR 位
+// 使用请求线时不再读状态寄存器：dreq_i 有效才传输一个单位，外设那一次访问应答之后
+// 在 dack_o 上给出一个周期的脉冲，外设借此在 FIFO 计数更新之前撤销请求
+// 寄存器只支持按字访问，忽略字节选择信号
+module wb_dma(
+    input wire        wb_clk_i,        // Wishbone 时钟
+    input wire        wb_rst_i,        // Wishbone 复位
+
+    // 寄存器访问接口，连接到总线互联矩阵的从设备接口
+    input wire        wb_cyc_i,
+    input wire        wb_stb_i,
+    input wire        wb_we_i,
+    input wire [3:0]  wb_sel_i,
+    input wire [31:0] wb_adr_i,
+    input wire [31:0] wb_dat_i,
+    output reg [31:0] wb_dat_o,
+    output reg        wb_ack_o,
+
+    // 数据搬运接口，连接到总线互联矩阵的主设备接口
+    output reg        m_cyc_o,
+    output reg        m_stb_o,
+    output reg        m_we_o,
+    output reg [3:0]  m_sel_o,
+    output reg [31:0] m_adr_o,
+    output reg [31:0] m_dat_o,
+    input wire [31:0] m_dat_i,
+    input wire        m_ack_i,
+
+    // 外设的 DMA 请求和应答，每条请求线一位
+    input wire  [1:0] dreq_i,
+    output reg  [1:0] dack_o,
+
+    // 完成中断，连接到 OpenMIPS 的中断输入
+    output wire       int_o
+    );
+
+// 主设备状态机状态定义
+parameter D_IDLE  = 2'b00;   // 选择下一个要服务的通道
+parameter D_POLL  = 2'b01;   // 读外设状态寄存器
+parameter D_READ  = 2'b10;   // 从源地址读一个单位
+parameter D_WRITE = 2'b11;   // 向目的地址写一个单位
+
+// 传输模式
+parameter MODE_M2M = 2'b00;
+parameter MODE_M2P = 2'b01;
+parameter MODE_P2M = 2'b10;
+
+// 各通道的寄存器
+reg [1:0]  ch_en;
+reg [1:0]  ch_ie;
+reg [1:0]  ch_done;
+reg [1:0]  ch_mode[0:1];
+reg [1:0]  ch_size[0:1];
+reg [1:0]  ch_hreq;
+reg [1:0]  ch_req_sel;
+reg [31:0] ch_src[0:1];
+reg [31:0] ch_dst[0:1];
+reg [31:0] ch_count[0:1];
+reg [31:0] ch_stat_addr[0:1];
+reg [7:0]  ch_stat_mask[0:1];
+
+reg [1:0]  state;
+reg        cur;                        // 正在服务的通道
+reg        last;                       // 上一次服务的通道，用于轮转仲裁
+reg [31:0] buffer;                     // 读出、尚未写入的数据
+
+integer i;
+
+// 按大端模式计算字节选择信号：低地址对应高字节，与 mem.v 的约定相同
+function [3:0] lane_sel;
+    input [1:0] size;
+    input [1:0] a;
+    begin
+        case(size)
+        2'b00:   lane_sel = 4'b1000 >> a;
+        2'b01:   lane_sel = a[1] ? 4'b0011 : 4'b1100;
+        default: lane_sel = 4'b1111;
+        endcase
+    end
+endfunction
+
+// 从总线读出的字中取出本次访问的字节或半字，放在低位
+function [31:0] lane_get;
+    input [1:0]  size;
+    input [1:0]  a;
+    input [31:0] d;
+    begin
+        case(size)
+        2'b00:   lane_get = {24'h000000, d[31 - {a, 3'b000} -: 8]};
+        2'b01:   lane_get = a[1] ? {16'h0000, d[15:0]} : {16'h0000, d[31:16]};
+        default: lane_get = d;
+        endcase
+    end
+endfunction
+
+// 写总线时把字节或半字复制到所有字节通道上，由字节选择信号决定写哪一个
+function [31:0] lane_put;
+    input [1:0]  size;
+    input [31:0] d;
+    begin
+        case(size)
+        2'b00:   lane_put = {4{d[7:0]}};
+        2'b01:   lane_put = {2{d[15:0]}};
+        default: lane_put = d;
+        endcase
+    end
+endfunction
+
+wire        nxt       = ch_en[~last] ? ~last : last;        // 轮转仲裁选出的通道
+wire [31:0] step      = (ch_size[cur] == 2'b00) ? 32'd1 :
+                        (ch_size[cur] == 2'b01) ? 32'd2 : 32'd4;
+wire [7:0]  stat_byte = lane_get(2'b00, ch_stat_addr[cur][1:0], m_dat_i);
+wire        nxt_ready = dreq_i[ch_req_sel[nxt]];                  // 轮转选出的通道的请求线
+
+wire        reg_req   = wb_cyc_i & wb_stb_i & ~wb_ack_o;
+wire        reg_ch    = wb_adr_i[5];
+wire        reg_glb   = wb_adr_i[6];
+wire [2:0]  reg_idx   = wb_adr_i[4:2];
+
+assign int_o = |(ch_done & ch_ie);
+
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        state    <= D_IDLE;
+        cur      <= 1'b0;
+        last     <= 1'b0;
+        buffer   <= 32'h00000000;
+        ch_en    <= 2'b00;
+        ch_ie    <= 2'b00;
+        ch_done  <= 2'b00;
+        ch_hreq  <= 2'b00;
+        ch_req_sel <= 2'b00;
+        dack_o   <= 2'b00;
+        for(i = 0; i < 2; i = i + 1) begin
+            ch_mode[i]      <= MODE_M2M;
+            ch_size[i]      <= 2'b10;
+            ch_src[i]       <= 32'h00000000;
+            ch_dst[i]       <= 32'h00000000;
+            ch_count[i]     <= 32'h00000000;
+            ch_stat_addr[i] <= 32'h00000000;
+            ch_stat_mask[i] <= 8'h00;
+        end
+        wb_ack_o <= 1'b0;
+        wb_dat_o <= 32'h00000000;
+        m_cyc_o  <= 1'b0;
+        m_stb_o  <= 1'b0;
+        m_we_o   <= 1'b0;
+        m_sel_o  <= 4'b0000;
+        m_adr_o  <= 32'h00000000;
+        m_dat_o  <= 32'h00000000;
+    end
+    else begin
+        dack_o <= 2'b00;                       // 应答脉冲只保持一个周期
+
+        // 主设备状态机，每次应答之后撤销总线周期，至少空闲一个周期再发起下一次访问
+        case(state)
+        D_IDLE:
+        begin
+            if(ch_en[nxt]) begin
+                cur  <= nxt;
+                last <= nxt;
+                if(ch_count[nxt] == 32'h00000000) begin
+                    ch_en[nxt]   <= 1'b0;          // 没有剩余的传输，直接完成
+                    ch_done[nxt] <= 1'b1;
+                end
+                else if(ch_mode[nxt] == MODE_M2M) begin
+                    state <= D_READ;
+                end
+                else if(ch_hreq[nxt]) begin
+                    // 外设没有请求时留在 D_IDLE，不占用总线，下个周期轮到另一个通道
+                    if(nxt_ready) begin
+                        state <= D_READ;
+                    end
+                end
+                else begin
+                    state <= D_POLL;
+                end
+            end
+        end
+
+        D_POLL:
+        begin
+            if(~m_cyc_o) begin
+                m_cyc_o <= 1'b1;
+                m_stb_o <= 1'b1;
+                m_we_o  <= 1'b0;
+                m_sel_o <= lane_sel(2'b00, ch_stat_addr[cur][1:0]);
+                m_adr_o <= {ch_stat_addr[cur][31:2], 2'b00};
+            end
+            else if(m_ack_i) begin
+                m_cyc_o <= 1'b0;
+                m_stb_o <= 1'b0;
+                // 外设没有准备好时回到 D_IDLE，让另一个通道有机会使用总线
+                state   <= ((stat_byte & ch_stat_mask[cur]) != 8'h00) ? D_READ : D_IDLE;
+            end
+        end
+
+        D_READ:
+        begin
+            if(~m_cyc_o) begin
+                m_cyc_o <= 1'b1;
+                m_stb_o <= 1'b1;
+                m_we_o  <= 1'b0;
+                m_sel_o <= lane_sel(ch_size[cur], ch_src[cur][1:0]);
+                m_adr_o <= {ch_src[cur][31:2], 2'b00};
+            end
+            else if(m_ack_i) begin
+                m_cyc_o <= 1'b0;
+                m_stb_o <= 1'b0;
+                buffer  <= lane_get(ch_size[cur], ch_src[cur][1:0], m_dat_i);
+                if(ch_hreq[cur] && ch_mode[cur] == MODE_P2M) begin
+                    dack_o[ch_req_sel[cur]] <= 1'b1;
+                end
+                state   <= D_WRITE;
+            end
+        end
+
+        D_WRITE:
+        begin
+            if(~m_cyc_o) begin
+                m_cyc_o <= 1'b1;
+                m_stb_o <= 1'b1;
+                m_we_o  <= 1'b1;
+                m_sel_o <= lane_sel(ch_size[cur], ch_dst[cur][1:0]);
+                m_adr_o <= {ch_dst[cur][31:2], 2'b00};
+                m_dat_o <= lane_put(ch_size[cur], buffer);
+            end
+            else if(m_ack_i) begin
+                m_cyc_o <= 1'b0;
+                m_stb_o <= 1'b0;
+                m_we_o  <= 1'b0;
+                if(ch_mode[cur] != MODE_P2M) begin
+                    ch_src[cur] <= ch_src[cur] + step;
+                end
+                if(ch_mode[cur] != MODE_M2P) begin
+                    ch_dst[cur] <= ch_dst[cur] + step;
+                end
+                ch_count[cur] <= ch_count[cur] - 32'd1;
+                if(ch_hreq[cur] && ch_mode[cur] == MODE_M2P) begin
+                    dack_o[ch_req_sel[cur]] <= 1'b1;
+                end
+                if(ch_count[cur] == 32'd1) begin
+                    ch_en[cur]   <= 1'b0;
+                    ch_done[cur] <= 1'b1;
+                end
+                state <= D_IDLE;
+            end
+        end
+        endcase
+
+        // 寄存器访问，放在状态机之后，与硬件更新冲突时以软件写入为准
+        wb_ack_o <= reg_req;                   // 应答只保持一个周期
+        if(reg_req) begin
+            if(reg_glb) begin
+                wb_dat_o <= {30'h00000000, ch_done};
+            end
+            else begin
+                case(reg_idx)
+                3'd0:    wb_dat_o <= {24'h000000, ch_req_sel[reg_ch], ch_hreq[reg_ch], ch_size[reg_ch],
+                                      ch_mode[reg_ch], ch_ie[reg_ch], ch_en[reg_ch]};
+                3'd1:    wb_dat_o <= ch_src[reg_ch];
+                3'd2:    wb_dat_o <= ch_dst[reg_ch];
+                3'd3:    wb_dat_o <= ch_count[reg_ch];
+                3'd4:    wb_dat_o <= ch_stat_addr[reg_ch];
+                3'd5:    wb_dat_o <= {24'h000000, ch_stat_mask[reg_ch]};
+                default: wb_dat_o <= 32'h00000000;
+                endcase
+            end
+        end
+
+        if(reg_req & wb_we_i) begin
+            if(reg_glb) begin
+                if(wb_dat_i[0]) ch_done[0] <= 1'b0;
+                if(wb_dat_i[1]) ch_done[1] <= 1'b0;
+            end
+            else begin
+                case(reg_idx)
+                3'd0:
+                begin
+                    ch_en[reg_ch]   <= wb_dat_i[0];
+                    ch_ie[reg_ch]   <= wb_dat_i[1];
+                    ch_mode[reg_ch] <= wb_dat_i[3:2];
+                    ch_size[reg_ch] <= wb_dat_i[5:4];
+                    ch_hreq[reg_ch] <= wb_dat_i[6];
+                    ch_req_sel[reg_ch] <= wb_dat_i[7];
+                    if(wb_dat_i[0]) begin
+                        ch_done[reg_ch] <= 1'b0;   // 重新启动时清除上一次的完成标志
+                    end
+                end
+                3'd1:    ch_src[reg_ch]       <= wb_dat_i;
+                3'd2:    ch_dst[reg_ch]       <= wb_dat_i;
+                3'd3:    ch_count[reg_ch]     <= wb_dat_i;
+                3'd4:    ch_stat_addr[reg_ch] <= wb_dat_i;
+                3'd5:    ch_stat_mask[reg_ch] <= wb_dat_i[7:0];
+                default: ;
+                endcase
+            end
+        end
+    end
+end
+
+endmodule
@@ -0,0 +1,353 @@
+`timescale 1ns / 1ps
+
+// 精简的 Wishbone 总线互联：按本系统实际的 3 个主设备、12 个从设备实现，可以替代 wb_conmax_top
+// 地址的高 4 位选择从设备，与 wb_conmax_top 的地址映射相同：
+//   0 SDRAM  1 UART  2 GPIO  3 Flash  4 启动 ROM  5 DMA 寄存器  6 总线性能监视器  7 数码管
+//   8 中断控制器  9 定时器  10 CRC 计算单元  11 就绪表
+// 端口的命名与 wb_conmax_top 相同，在 openmips_min_sopc.v 中用 `WB_LITE_INTERCON 选择
+//
+// 每个从设备有一个独立的轮转仲裁器，不同的主设备访问不同的从设备时互不影响
+// wb_conmax_top 的主设备接口先把 cyc 寄存一拍，从设备接口再要求 cyc 连续两个周期有效，
+// 每次访问在请求路径上要多花 2 个周期；这里的仲裁和地址译码都是组合逻辑：
+//   REGISTERED = 0  请求直接送到从设备，不增加周期，每次访问比 wb_conmax_top 少 2 个周期
+//   REGISTERED = 1  请求经过一级寄存器再送到从设备，增加 1 个周期，用于时序紧张的情况，
+//                   每次访问仍比 wb_conmax_top 少 1 个周期
+// 应答和读数据在两种方式下都是组合逻辑直接返回主设备
+//
+// 主设备在访问中途撤销总线周期（流水线被清除）时，从设备可能还在处理这次访问，
+// 此时该从设备至少空闲一个周期（cyc 为 0）才交给其它主设备，让从设备能够识别出
+// 被放弃的访问，不会把应答错给下一个主设备
+module wb_lite_intercon #(
+    parameter REGISTERED = 0
+)(
+    input wire clk_i,
+    input wire rst_i,
+
+    // 主设备接口 0
+    input wire [31:0]  m0_data_i,
+    output wire [31:0] m0_data_o,
+    input wire [31:0]  m0_addr_i,
+    input wire [3:0]   m0_sel_i,
+    input wire         m0_we_i,
+    input wire         m0_cyc_i,
+    input wire         m0_stb_i,
+    output wire        m0_ack_o,
+
+    // 主设备接口 1
+    input wire [31:0]  m1_data_i,
+    output wire [31:0] m1_data_o,
+    input wire [31:0]  m1_addr_i,
+    input wire [3:0]   m1_sel_i,
+    input wire         m1_we_i,
+    input wire         m1_cyc_i,
+    input wire         m1_stb_i,
+    output wire        m1_ack_o,
+
+    // 主设备接口 2
+    input wire [31:0]  m2_data_i,
+    output wire [31:0] m2_data_o,
+    input wire [31:0]  m2_addr_i,
+    input wire [3:0]   m2_sel_i,
+    input wire         m2_we_i,
+    input wire         m2_cyc_i,
+    input wire         m2_stb_i,
+    output wire        m2_ack_o,
+
+    // 从设备接口 0
+    input wire [31:0]  s0_data_i,
+    output wire [31:0] s0_data_o,
+    output wire [31:0] s0_addr_o,
+    output wire [3:0]  s0_sel_o,
+    output wire        s0_we_o,
+    output wire        s0_cyc_o,
+    output wire        s0_stb_o,
+    input wire         s0_ack_i,
+
+    // 从设备接口 1
+    input wire [31:0]  s1_data_i,
+    output wire [31:0] s1_data_o,
+    output wire [31:0] s1_addr_o,
+    output wire [3:0]  s1_sel_o,
+    output wire        s1_we_o,
+    output wire        s1_cyc_o,
+    output wire        s1_stb_o,
+    input wire         s1_ack_i,
+
+    // 从设备接口 2
+    input wire [31:0]  s2_data_i,
+    output wire [31:0] s2_data_o,
+    output wire [31:0] s2_addr_o,
+    output wire [3:0]  s2_sel_o,
+    output wire        s2_we_o,
+    output wire        s2_cyc_o,
+    output wire        s2_stb_o,
+    input wire         s2_ack_i,
+
+    // 从设备接口 3
+    input wire [31:0]  s3_data_i,
+    output wire [31:0] s3_data_o,
+    output wire [31:0] s3_addr_o,
+    output wire [3:0]  s3_sel_o,
+    output wire        s3_we_o,
+    output wire        s3_cyc_o,
+    output wire        s3_stb_o,
+    input wire         s3_ack_i,
+
+    // 从设备接口 4
+    input wire [31:0]  s4_data_i,
+    output wire [31:0] s4_data_o,
+    output wire [31:0] s4_addr_o,
+    output wire [3:0]  s4_sel_o,
+    output wire        s4_we_o,
+    output wire        s4_cyc_o,
+    output wire        s4_stb_o,
+    input wire         s4_ack_i,
+
+    // 从设备接口 5
+    input wire [31:0]  s5_data_i,
+    output wire [31:0] s5_data_o,
+    output wire [31:0] s5_addr_o,
+    output wire [3:0]  s5_sel_o,
+    output wire        s5_we_o,
+    output wire        s5_cyc_o,
+    output wire        s5_stb_o,
+    input wire         s5_ack_i,
+
+    // 从设备接口 6
+    input wire [31:0]  s6_data_i,
+    output wire [31:0] s6_data_o,
+    output wire [31:0] s6_addr_o,
+    output wire [3:0]  s6_sel_o,
+    output wire        s6_we_o,
+    output wire        s6_cyc_o,
+    output wire        s6_stb_o,
+    input wire         s6_ack_i,
+
+    // 从设备接口 7
+    input wire [31:0]  s7_data_i,
+    output wire [31:0] s7_data_o,
+    output wire [31:0] s7_addr_o,
+    output wire [3:0]  s7_sel_o,
+    output wire        s7_we_o,
+    output wire        s7_cyc_o,
+    output wire        s7_stb_o,
+    input wire         s7_ack_i,
+
+    // 从设备接口 8
+    input wire [31:0]  s8_data_i,
+    output wire [31:0] s8_data_o,
+    output wire [31:0] s8_addr_o,
+    output wire [3:0]  s8_sel_o,
+    output wire        s8_we_o,
+    output wire        s8_cyc_o,
+    output wire        s8_stb_o,
+    input wire         s8_ack_i,
+
+    // 从设备接口 9
+    input wire [31:0]  s9_data_i,
+    output wire [31:0] s9_data_o,
+    output wire [31:0] s9_addr_o,
+    output wire [3:0]  s9_sel_o,
+    output wire        s9_we_o,
+    output wire        s9_cyc_o,
+    output wire        s9_stb_o,
+    input wire         s9_ack_i,
+
+    // 从设备接口 10
+    input wire [31:0]  s10_data_i,
+    output wire [31:0] s10_data_o,
+    output wire [31:0] s10_addr_o,
+    output wire [3:0]  s10_sel_o,
+    output wire        s10_we_o,
+    output wire        s10_cyc_o,
+    output wire        s10_stb_o,
+    input wire         s10_ack_i,
+
+    // 从设备接口 11
+    input wire [31:0]  s11_data_i,
+    output wire [31:0] s11_data_o,
+    output wire [31:0] s11_addr_o,
+    output wire [3:0]  s11_sel_o,
+    output wire        s11_we_o,
+    output wire        s11_cyc_o,
+    output wire        s11_stb_o,
+    input wire         s11_ack_i
+    );
+
+parameter M_NUM  = 3;
+parameter S_NUM  = 12;
+parameter M_NONE = 2'd3;     // 没有主设备得到授权
+
+// 把各个端口整理成数组，便于下面按从设备循环
+wire [31:0] m_data[0:M_NUM - 1];
+wire [31:0] m_addr[0:M_NUM - 1];
+wire [3:0]  m_sel[0:M_NUM - 1];
+wire        m_we[0:M_NUM - 1];
+wire        m_cyc[0:M_NUM - 1];
+wire        m_stb[0:M_NUM - 1];
+
+assign m_data[0] = m0_data_i;  assign m_addr[0] = m0_addr_i;  assign m_sel[0] = m0_sel_i;
+assign m_we[0]   = m0_we_i;    assign m_cyc[0]  = m0_cyc_i;   assign m_stb[0] = m0_stb_i;
+assign m_data[1] = m1_data_i;  assign m_addr[1] = m1_addr_i;  assign m_sel[1] = m1_sel_i;
+assign m_we[1]   = m1_we_i;    assign m_cyc[1]  = m1_cyc_i;   assign m_stb[1] = m1_stb_i;
+assign m_data[2] = m2_data_i;  assign m_addr[2] = m2_addr_i;  assign m_sel[2] = m2_sel_i;
+assign m_we[2]   = m2_we_i;    assign m_cyc[2]  = m2_cyc_i;   assign m_stb[2] = m2_stb_i;
+
+wire [31:0] s_rdata[0:S_NUM - 1];
+wire        s_ack[0:S_NUM - 1];
+wire [31:0] s_wdata[0:S_NUM - 1];
+wire [31:0] s_addr[0:S_NUM - 1];
+wire [3:0]  s_sel[0:S_NUM - 1];
+wire        s_we[0:S_NUM - 1];
+wire        s_cyc[0:S_NUM - 1];
+wire [M_NUM - 1:0] s_ack_to[0:S_NUM - 1];   // 从设备 s 的应答送给哪个主设备
+
+assign s_rdata[0] = s0_data_i;  assign s_ack[0] = s0_ack_i;
+assign s_rdata[1] = s1_data_i;  assign s_ack[1] = s1_ack_i;
+assign s_rdata[2] = s2_data_i;  assign s_ack[2] = s2_ack_i;
+assign s_rdata[3] = s3_data_i;  assign s_ack[3] = s3_ack_i;
+assign s_rdata[4] = s4_data_i;  assign s_ack[4] = s4_ack_i;
+assign s_rdata[5] = s5_data_i;  assign s_ack[5] = s5_ack_i;
+assign s_rdata[6] = s6_data_i;  assign s_ack[6] = s6_ack_i;
+assign s_rdata[7] = s7_data_i;  assign s_ack[7] = s7_ack_i;
+assign s_rdata[8] = s8_data_i;  assign s_ack[8] = s8_ack_i;
+assign s_rdata[9] = s9_data_i;  assign s_ack[9] = s9_ack_i;
+assign s_rdata[10] = s10_data_i;  assign s_ack[10] = s10_ack_i;
+assign s_rdata[11] = s11_data_i;  assign s_ack[11] = s11_ack_i;
+
+assign s0_data_o = s_wdata[0];  assign s0_addr_o = s_addr[0];  assign s0_sel_o = s_sel[0];
+assign s0_we_o   = s_we[0];     assign s0_cyc_o  = s_cyc[0];   assign s0_stb_o = s_cyc[0];
+assign s1_data_o = s_wdata[1];  assign s1_addr_o = s_addr[1];  assign s1_sel_o = s_sel[1];
+assign s1_we_o   = s_we[1];     assign s1_cyc_o  = s_cyc[1];   assign s1_stb_o = s_cyc[1];
+assign s2_data_o = s_wdata[2];  assign s2_addr_o = s_addr[2];  assign s2_sel_o = s_sel[2];
+assign s2_we_o   = s_we[2];     assign s2_cyc_o  = s_cyc[2];   assign s2_stb_o = s_cyc[2];
+assign s3_data_o = s_wdata[3];  assign s3_addr_o = s_addr[3];  assign s3_sel_o = s_sel[3];
+assign s3_we_o   = s_we[3];     assign s3_cyc_o  = s_cyc[3];   assign s3_stb_o = s_cyc[3];
+assign s4_data_o = s_wdata[4];  assign s4_addr_o = s_addr[4];  assign s4_sel_o = s_sel[4];
+assign s4_we_o   = s_we[4];     assign s4_cyc_o  = s_cyc[4];   assign s4_stb_o = s_cyc[4];
+assign s5_data_o = s_wdata[5];  assign s5_addr_o = s_addr[5];  assign s5_sel_o = s_sel[5];
+assign s5_we_o   = s_we[5];     assign s5_cyc_o  = s_cyc[5];   assign s5_stb_o = s_cyc[5];
+assign s6_data_o = s_wdata[6];  assign s6_addr_o = s_addr[6];  assign s6_sel_o = s_sel[6];
+assign s6_we_o   = s_we[6];     assign s6_cyc_o  = s_cyc[6];   assign s6_stb_o = s_cyc[6];
+assign s7_data_o = s_wdata[7];  assign s7_addr_o = s_addr[7];  assign s7_sel_o = s_sel[7];
+assign s7_we_o   = s_we[7];     assign s7_cyc_o  = s_cyc[7];   assign s7_stb_o = s_cyc[7];
+assign s8_data_o = s_wdata[8];  assign s8_addr_o = s_addr[8];  assign s8_sel_o = s_sel[8];
+assign s8_we_o   = s_we[8];     assign s8_cyc_o  = s_cyc[8];   assign s8_stb_o = s_cyc[8];
+assign s9_data_o = s_wdata[9];  assign s9_addr_o = s_addr[9];  assign s9_sel_o = s_sel[9];
+assign s9_we_o   = s_we[9];     assign s9_cyc_o  = s_cyc[9];   assign s9_stb_o = s_cyc[9];
+assign s10_data_o = s_wdata[10];  assign s10_addr_o = s_addr[10];  assign s10_sel_o = s_sel[10];
+assign s10_we_o   = s_we[10];     assign s10_cyc_o  = s_cyc[10];   assign s10_stb_o = s_cyc[10];
+assign s11_data_o = s_wdata[11];  assign s11_addr_o = s_addr[11];  assign s11_sel_o = s_sel[11];
+assign s11_we_o   = s_we[11];     assign s11_cyc_o  = s_cyc[11];   assign s11_stb_o = s_cyc[11];
+
+// 轮转仲裁：从上一次得到授权的主设备的下一个开始，选第一个有请求的
+function [1:0] rr_pick;
+    input [M_NUM - 1:0] req;
+    input [1:0]         last;
+    begin
+        case(last)
+        2'd0:    rr_pick = req[1] ? 2'd1 : req[2] ? 2'd2 : req[0] ? 2'd0 : M_NONE;
+        2'd1:    rr_pick = req[2] ? 2'd2 : req[0] ? 2'd0 : req[1] ? 2'd1 : M_NONE;
+        default: rr_pick = req[0] ? 2'd0 : req[1] ? 2'd1 : req[2] ? 2'd2 : M_NONE;
+        endcase
+    end
+endfunction
+
+genvar s;
+generate
+for(s = 0; s < S_NUM; s = s + 1) begin : slv
+    // 各主设备对本从设备的请求
+    wire [M_NUM - 1:0] req;
+    assign req[0] = m_cyc[0] & m_stb[0] & (m_addr[0][31:28] == s);
+    assign req[1] = m_cyc[1] & m_stb[1] & (m_addr[1][31:28] == s);
+    assign req[2] = m_cyc[2] & m_stb[2] & (m_addr[2][31:28] == s);
+
+    reg [1:0] owner;         // 最近一次得到授权的主设备
+    reg       pend;          // REGISTERED = 0：上一个周期有未应答的访问
+    reg       cyc_r;         // REGISTERED = 1：寄存后的请求
+    reg [31:0] wdata_r;
+    reg [31:0] addr_r;
+    reg [3:0]  sel_r;
+    reg        we_r;
+    reg [1:0]  gnt;
+
+    // 从设备上还有 owner 发起、没有应答的访问
+    wire busy = (REGISTERED != 0) ? (cyc_r & ~s_ack[s]) : pend;
+
+    // 访问进行中只能由 owner 继续，owner 放弃了就空闲一个周期
+    always @ (*) begin
+        if(busy) begin
+            gnt = req[owner] ? owner : M_NONE;
+        end
+        else if(req[owner]) begin
+            gnt = owner;
+        end
+        else begin
+            gnt = rr_pick(req, owner);
+        end
+    end
+
+    always @ (posedge clk_i or posedge rst_i) begin
+        if(rst_i) begin
+            owner   <= 2'd0;
+            pend    <= 1'b0;
+            cyc_r   <= 1'b0;
+            wdata_r <= 32'h00000000;
+            addr_r  <= 32'h00000000;
+            sel_r   <= 4'b0000;
+            we_r    <= 1'b0;
+        end
+        else begin
+            if(gnt != M_NONE) begin
+                owner <= gnt;
+            end
+            pend  <= (gnt != M_NONE) & ~s_ack[s];
+            // 收到应答后撤销一个周期，主设备要到下一个周期才撤销请求，不能再发一次
+            cyc_r <= (gnt != M_NONE) & ~(cyc_r & s_ack[s]);
+            if(gnt != M_NONE) begin
+                wdata_r <= m_data[gnt];
+                addr_r  <= m_addr[gnt];
+                sel_r   <= m_sel[gnt];
+                we_r    <= m_we[gnt];
+            end
+        end
+    end
+
+    if(REGISTERED != 0) begin : reg_path
+        assign s_cyc[s]   = cyc_r;
+        assign s_wdata[s] = wdata_r;
+        assign s_addr[s]  = addr_r;
+        assign s_sel[s]   = sel_r;
+        assign s_we[s]    = we_r;
+        // 主设备已经撤销请求时不再应答
+        assign s_ack_to[s] = {M_NUM{s_ack[s] & cyc_r}} & req &
+                             {(owner == 2'd2), (owner == 2'd1), (owner == 2'd0)};
+    end
+    else begin : comb_path
+        assign s_cyc[s]   = (gnt != M_NONE);
+        assign s_wdata[s] = m_data[(gnt == M_NONE) ? owner : gnt];
+        assign s_addr[s]  = m_addr[(gnt == M_NONE) ? owner : gnt];
+        assign s_sel[s]   = m_sel[(gnt == M_NONE) ? owner : gnt];
+        assign s_we[s]    = m_we[(gnt == M_NONE) ? owner : gnt];
+        assign s_ack_to[s] = {M_NUM{s_ack[s]}} &
+                             {(gnt == 2'd2), (gnt == 2'd1), (gnt == 2'd0)};
+    end
+end
+endgenerate
+
+// 应答送回发起访问的主设备，读数据按主设备的地址直接选择
+assign m0_ack_o = s_ack_to[0][0] | s_ack_to[1][0] | s_ack_to[2][0] | s_ack_to[3][0] |
+                  s_ack_to[4][0] | s_ack_to[5][0] | s_ack_to[6][0] | s_ack_to[7][0] |
+                  s_ack_to[8][0] | s_ack_to[9][0] | s_ack_to[10][0] | s_ack_to[11][0];
+assign m1_ack_o = s_ack_to[0][1] | s_ack_to[1][1] | s_ack_to[2][1] | s_ack_to[3][1] |
+                  s_ack_to[4][1] | s_ack_to[5][1] | s_ack_to[6][1] | s_ack_to[7][1] |
+                  s_ack_to[8][1] | s_ack_to[9][1] | s_ack_to[10][1] | s_ack_to[11][1];
+assign m2_ack_o = s_ack_to[0][2] | s_ack_to[1][2] | s_ack_to[2][2] | s_ack_to[3][2] |
+                  s_ack_to[4][2] | s_ack_to[5][2] | s_ack_to[6][2] | s_ack_to[7][2] |
+                  s_ack_to[8][2] | s_ack_to[9][2] | s_ack_to[10][2] | s_ack_to[11][2];
+
+assign m0_data_o = (m0_addr_i[31:28] < S_NUM) ? s_rdata[m0_addr_i[31:28]] : 32'h00000000;
+assign m1_data_o = (m1_addr_i[31:28] < S_NUM) ? s_rdata[m1_addr_i[31:28]] : 32'h00000000;
+assign m2_data_o = (m2_addr_i[31:28] < S_NUM) ? s_rdata[m2_addr_i[31:28]] : 32'h00000000;
+
+endmodule
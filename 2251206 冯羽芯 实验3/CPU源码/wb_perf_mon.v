@@ -0,0 +1,214 @@
+`timescale 1ns / 1ps
+
+// 总线性能监视器：旁听 3 个主设备的 Wishbone 总线，统计每个主设备访问每个从设备的
+// 次数和等待周期，寄存器接口挂在总线互联的从设备接口 6（0x60000000）
+//
+// 一次访问从主设备的 cyc、stb 有效开始，到收到应答为止，期间的周期数（包括应答所在的
+// 周期）记为这次访问的延迟；应答之前主设备撤销了总线周期（流水线被清除）记为一次放弃。
+// 主设备 0 是数据总线，1 是指令总线（包括直接送到 SDRAM 指令端口的访问），2 是 DMA，
+// 从设备按地址的 [31:28] 区分，16 个地址区域都统计
+//
+// 寄存器（都按字访问）：
+//   0x000 CTRL    [0] EN 为 1 时统计，写 [1] 为 1 清零所有计数器
+//   0x004 CYCLES  统计期间经过的周期数
+//   0x100 + m * 0x100 + s * 0x10  主设备 m 访问从设备 s 的统计
+//         +0x0 COUNT  完成的访问次数
+//         +0x4 TOTAL  这些访问的延迟之和，TOTAL / COUNT 就是平均延迟
+//         +0x8 MAX    最大延迟
+//         +0xC ABORT  放弃的访问次数
+//   0x400 + s * 0x20 + b * 4     从设备 s 的延迟直方图（不区分主设备），第 b 个区间：
+//         b = 0..7 分别对应延迟 1、2、3~4、5~8、9~16、17~32、33~64、65 以上
+module wb_perf_mon(
+    input wire        wb_clk_i,        // Wishbone 时钟
+    input wire        wb_rst_i,        // Wishbone 复位
+
+    // 寄存器访问接口，连接到总线互联的从设备接口
+    input wire        wb_cyc_i,
+    input wire        wb_stb_i,
+    input wire        wb_we_i,
+    input wire [3:0]  wb_sel_i,
+    input wire [31:0] wb_adr_i,
+    input wire [31:0] wb_dat_i,
+    output reg [31:0] wb_dat_o,
+    output reg        wb_ack_o,
+
+    // 被监视的主设备，每个主设备一位，地址每个主设备 32 位
+    input wire [2:0]  mon_cyc_i,
+    input wire [2:0]  mon_stb_i,
+    input wire [2:0]  mon_ack_i,
+    input wire [95:0] mon_adr_i
+    );
+
+parameter M_NUM = 3;
+parameter S_NUM = 16;
+
+reg         en;
+reg [31:0]  cycles;
+
+// 每个主设备正在进行的访问
+reg [M_NUM - 1:0] busy;
+reg [15:0]        lat[0:M_NUM - 1];     // 已经等待的周期数，到 0xFFFF 不再增加
+reg [3:0]         slv[0:M_NUM - 1];
+
+// 统计结果，下标为 m * S_NUM + s
+reg [31:0]  st_count[0:M_NUM * S_NUM - 1];
+reg [31:0]  st_total[0:M_NUM * S_NUM - 1];
+reg [15:0]  st_max[0:M_NUM * S_NUM - 1];
+reg [31:0]  st_abort[0:M_NUM * S_NUM - 1];
+// 直方图，下标为 s * 8 + b
+reg [31:0]  hist[0:S_NUM * 8 - 1];
+
+// 本周期的访问状态
+reg [M_NUM - 1:0] done;                 // 收到应答
+reg [M_NUM - 1:0] abort;                // 没有收到应答就撤销了总线周期
+reg [15:0]        cur_lat[0:M_NUM - 1];
+reg [3:0]         cur_slv[0:M_NUM - 1];
+reg [2:0]         cur_bkt[0:M_NUM - 1];
+
+integer m, e;
+reg [1:0] inc;
+
+// 延迟所在的直方图区间
+function [2:0] bucket;
+    input [15:0] l;
+    begin
+        if(l <= 16'd1)       bucket = 3'd0;
+        else if(l <= 16'd2)  bucket = 3'd1;
+        else if(l <= 16'd4)  bucket = 3'd2;
+        else if(l <= 16'd8)  bucket = 3'd3;
+        else if(l <= 16'd16) bucket = 3'd4;
+        else if(l <= 16'd32) bucket = 3'd5;
+        else if(l <= 16'd64) bucket = 3'd6;
+        else                 bucket = 3'd7;
+    end
+endfunction
+
+always @ (*) begin
+    for(m = 0; m < M_NUM; m = m + 1) begin
+        // 新开始的访问从这个周期算起，延迟至少为 1
+        cur_lat[m] = busy[m] ? ((lat[m] == 16'hFFFF) ? lat[m] : lat[m] + 16'd1) : 16'd1;
+        cur_slv[m] = busy[m] ? slv[m] : mon_adr_i[m * 32 + 28 +: 4];
+        cur_bkt[m] = bucket(cur_lat[m]);
+        done[m]    = mon_cyc_i[m] & mon_stb_i[m] & mon_ack_i[m];
+        abort[m]   = busy[m] & ~(mon_cyc_i[m] & mon_stb_i[m]);
+    end
+end
+
+wire        reg_req = wb_cyc_i & wb_stb_i & ~wb_ack_o;
+wire [8:0]  reg_idx = wb_adr_i[10:2];
+wire        clr     = reg_req & wb_we_i & (reg_idx == 9'd0) & wb_dat_i[1];
+wire [1:0]  reg_m   = reg_idx[7:6] - 2'd1;              // 0x100 ~ 0x3FF 中的主设备
+wire [5:0]  st_idx  = {reg_m, reg_idx[5:2]};             // 对应统计结果的下标
+wire        st_sel  = ~reg_idx[8] && (reg_idx[7:6] != 2'd0);
+wire        hist_sel = reg_idx[8] && ~reg_idx[7];        // 0x400 ~ 0x5FF
+
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        busy <= {M_NUM{1'b0}};
+        for(m = 0; m < M_NUM; m = m + 1) begin
+            lat[m]    <= 16'h0000;
+            slv[m]    <= 4'd0;
+        end
+    end
+    else begin
+        for(m = 0; m < M_NUM; m = m + 1) begin
+            busy[m]   <= mon_cyc_i[m] & mon_stb_i[m] & ~mon_ack_i[m];
+            lat[m]    <= cur_lat[m];
+            slv[m]    <= cur_slv[m];
+        end
+    end
+end
+
+// 统计计数器
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        cycles <= 32'h00000000;
+        for(e = 0; e < M_NUM * S_NUM; e = e + 1) begin
+            st_count[e] <= 32'h00000000;
+            st_total[e] <= 32'h00000000;
+            st_max[e]   <= 16'h0000;
+            st_abort[e] <= 32'h00000000;
+        end
+        for(e = 0; e < S_NUM * 8; e = e + 1) begin
+            hist[e] <= 32'h00000000;
+        end
+    end
+    else if(clr) begin
+        cycles <= 32'h00000000;
+        for(e = 0; e < M_NUM * S_NUM; e = e + 1) begin
+            st_count[e] <= 32'h00000000;
+            st_total[e] <= 32'h00000000;
+            st_max[e]   <= 16'h0000;
+            st_abort[e] <= 32'h00000000;
+        end
+        for(e = 0; e < S_NUM * 8; e = e + 1) begin
+            hist[e] <= 32'h00000000;
+        end
+    end
+    else if(en) begin
+        cycles <= cycles + 32'd1;
+        // 每个主设备只更新自己的那一组计数器
+        for(m = 0; m < M_NUM; m = m + 1) begin
+            if(done[m]) begin
+                st_count[m * S_NUM + cur_slv[m]] <= st_count[m * S_NUM + cur_slv[m]] + 32'd1;
+                st_total[m * S_NUM + cur_slv[m]] <= st_total[m * S_NUM + cur_slv[m]] + cur_lat[m];
+                if(cur_lat[m] > st_max[m * S_NUM + cur_slv[m]]) begin
+                    st_max[m * S_NUM + cur_slv[m]] <= cur_lat[m];
+                end
+            end
+            if(abort[m]) begin
+                st_abort[m * S_NUM + slv[m]] <= st_abort[m * S_NUM + slv[m]] + 32'd1;
+            end
+        end
+        // SDRAM 的数据端口和指令端口可以在同一个周期应答，直方图的同一项可能要加 2
+        for(e = 0; e < S_NUM * 8; e = e + 1) begin
+            inc = 2'd0;
+            for(m = 0; m < M_NUM; m = m + 1) begin
+                if(done[m] && ({cur_slv[m], cur_bkt[m]} == e)) begin
+                    inc = inc + 2'd1;
+                end
+            end
+            hist[e] <= hist[e] + inc;
+        end
+    end
+end
+
+// 寄存器访问，应答只保持一个周期
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        en       <= 1'b0;
+        wb_ack_o <= 1'b0;
+        wb_dat_o <= 32'h00000000;
+    end
+    else begin
+        wb_ack_o <= reg_req;
+        if(reg_req & wb_we_i & (reg_idx == 9'd0)) begin
+            en <= wb_dat_i[0];
+        end
+        if(reg_req) begin
+            if(reg_idx == 9'd0) begin
+                wb_dat_o <= {31'h00000000, en};
+            end
+            else if(reg_idx == 9'd1) begin
+                wb_dat_o <= cycles;
+            end
+            else if(hist_sel) begin                     // 0x400 ~ 0x5FF 直方图
+                wb_dat_o <= hist[reg_idx[6:0]];
+            end
+            else if(st_sel) begin
+                // reg_idx 的 [5:2] 为从设备，[1:0] 选择计数器
+                case(reg_idx[1:0])
+                2'd0:    wb_dat_o <= st_count[st_idx];
+                2'd1:    wb_dat_o <= st_total[st_idx];
+                2'd2:    wb_dat_o <= {16'h0000, st_max[st_idx]};
+                default: wb_dat_o <= st_abort[st_idx];
+                endcase
+            end
+            else begin
+                wb_dat_o <= 32'h00000000;
+            end
+        end
+    end
+end
+
+endmodule
@@ -0,0 +1,143 @@
+`timescale 1ns / 1ps
+
+// 可编程中断控制器：32 个中断源合并为一根中断请求线，连接到 OpenMIPS 的 int_i[0]，
+// 寄存器接口挂在总线互联的从设备接口 8（0x80000000）
+//
+// 每个中断源有 4 位优先级，数值大的优先，相同时编号小的优先，优先级为 0 的中断源不会
+// 产生中断。只有优先级高于 THRESH 的中断源才会请求中断，处理函数把 THRESH 设为正在
+// 处理的中断的优先级再打开中断，就只允许更高优先级的中断嵌套进来
+//
+// 寄存器（都按字访问）：
+//   0x00 PEND    [i] 中断源 i 有请求（不受屏蔽影响）。写 1 清除边沿触发的中断源锁存的请求
+//   0x04 MASK    [i] 为 1 时允许中断源 i，复位后都屏蔽
+//   0x08 EDGE    [i] 为 1 时中断源 i 为上升沿触发（锁存到写 1 清除），为 0 时为电平触发
+//   0x0C VECTOR  只读，优先级最高的待处理中断：[4:0] 中断源编号，[11:8] 优先级，
+//                [31] NONE 为 1 表示没有优先级高于 THRESH 的待处理中断
+//   0x10 ~ 0x1C  PRIO0 ~ PRIO3，每个中断源 4 位，PRIOn 的 [4k+3:4k] 为中断源 8n+k 的优先级
+//   0x20 THRESH  [3:0] 当前优先级
+module wb_pic(
+    // Wishbone 总线接口
+    input wire        wb_clk_i,        // Wishbone 时钟
+    input wire        wb_rst_i,        // Wishbone 复位
+    input wire        wb_cyc_i,        // Wishbone 总线周期有效
+    input wire        wb_stb_i,        // Wishbone 选通信号
+    input wire        wb_we_i,         // Wishbone 写使能
+    input wire [3:0]  wb_sel_i,        // Wishbone 字节选择
+    input wire [31:0] wb_adr_i,        // Wishbone 地址
+    input wire [31:0] wb_dat_i,        // Wishbone 写数据
+    output reg [31:0] wb_dat_o,        // Wishbone 读数据
+    output reg        wb_ack_o,        // Wishbone 应答
+
+    input wire [31:0] irq_i,           // 各中断源的请求，与 wb_clk_i 同步，高电平有效
+    output wire       int_o            // 送给处理器的中断请求
+    );
+
+reg [31:0]  mask;
+reg [31:0]  edge_sel;
+reg [31:0]  edge_pend;             // 边沿触发的中断源锁存的请求
+reg [31:0]  irq_d;                 // 上一个周期的 irq_i，用来检测上升沿
+reg [3:0]   prio[0:31];
+reg [3:0]   thresh;
+
+wire [31:0] pend   = (edge_sel & edge_pend) | (~edge_sel & irq_i);
+wire [31:0] active = pend & mask;
+
+wire        req     = wb_cyc_i & wb_stb_i & ~wb_ack_o;
+wire [3:0]  reg_idx = wb_adr_i[5:2];
+wire        pend_we = req & wb_we_i & (reg_idx == 4'd0);
+
+// 在 32 个中断源中选出优先级最高的，用 5 级两两比较的树，树的节点按堆的方式编号：
+// 节点 n 的两个子节点为 2n+1、2n+2，叶子 31 ~ 62 依次为中断源 0 ~ 31。
+// 左子树中的中断源编号都更小，优先级相同时选左边
+reg [3:0]   tp[0:62];
+reg [4:0]   tid[0:62];
+integer     n;
+
+always @ (*) begin
+    for(n = 0; n < 32; n = n + 1) begin
+        tp[31 + n]  = active[n] ? prio[n] : 4'd0;
+        tid[31 + n] = n;
+    end
+    for(n = 30; n >= 0; n = n - 1) begin
+        if(tp[2 * n + 1] >= tp[2 * n + 2]) begin
+            tp[n]  = tp[2 * n + 1];
+            tid[n] = tid[2 * n + 1];
+        end
+        else begin
+            tp[n]  = tp[2 * n + 2];
+            tid[n] = tid[2 * n + 2];
+        end
+    end
+end
+
+// 比较树的结果打一拍，与 THRESH 的比较不打拍，修改 THRESH 之后马上生效
+reg [3:0]   best_prio;
+reg [4:0]   best_id;
+wire        best_ok = (best_prio > thresh);
+
+assign int_o = best_ok;
+
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        best_prio <= 4'd0;
+        best_id   <= 5'd0;
+        irq_d     <= 32'h00000000;
+        edge_pend <= 32'h00000000;
+    end
+    else begin
+        best_prio <= tp[0];
+        best_id   <= tid[0];
+        irq_d     <= irq_i;
+        // 新的上升沿优先于同一个周期的清除
+        edge_pend <= (edge_pend & ~(pend_we ? wb_dat_i : 32'h00000000)) | (irq_i & ~irq_d);
+    end
+end
+
+// 寄存器访问，应答只保持一个周期
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        mask     <= 32'h00000000;
+        edge_sel <= 32'h00000000;
+        thresh   <= 4'd0;
+        for(n = 0; n < 32; n = n + 1) begin
+            prio[n] <= 4'd1;
+        end
+        wb_ack_o <= 1'b0;
+        wb_dat_o <= 32'h00000000;
+    end
+    else begin
+        wb_ack_o <= req;
+        if(req & wb_we_i) begin
+            case(reg_idx)
+            4'd1: mask     <= wb_dat_i;
+            4'd2: edge_sel <= wb_dat_i;
+            4'd4, 4'd5, 4'd6, 4'd7:
+            begin
+                for(n = 0; n < 8; n = n + 1) begin
+                    prio[{reg_idx[1:0], 3'b000} + n] <= wb_dat_i[4 * n +: 4];
+                end
+            end
+            4'd8: thresh   <= wb_dat_i[3:0];
+            default: ;
+            endcase
+        end
+        if(req) begin
+            case(reg_idx)
+            4'd0: wb_dat_o <= pend;
+            4'd1: wb_dat_o <= mask;
+            4'd2: wb_dat_o <= edge_sel;
+            4'd3: wb_dat_o <= {~best_ok, 19'h00000, best_prio, 3'b000, best_id};
+            4'd4, 4'd5, 4'd6, 4'd7:
+            begin
+                for(n = 0; n < 8; n = n + 1) begin
+                    wb_dat_o[4 * n +: 4] <= prio[{reg_idx[1:0], 3'b000} + n];
+                end
+            end
+            4'd8: wb_dat_o <= {28'h0000000, thresh};
+            default: wb_dat_o <= 32'h00000000;
+            endcase
+        end
+    end
+end
+
+endmodule
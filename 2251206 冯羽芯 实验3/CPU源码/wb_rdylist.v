@@ -0,0 +1,86 @@
+`timescale 1ns / 1ps
+
+// 就绪表：挂在总线互联的从设备接口 11（0xB0000000），代替 μC/OS-II 的 OSRdyGrp、OSRdyTbl[]
+// 保存 64 个优先级的就绪位，一次写操作就绪或取消就绪一个优先级，一次读操作得到就绪的最高优先级，
+// 不用再到 SDRAM 中查两次 OSUnMapTbl 表。另外提供一个只读的查找窗口，按地址给出 8 位数中
+// 最低的 1 的位置，代替事件等待表查找时使用的 OSUnMapTbl
+//
+// 寄存器（都按字访问）：
+//   0x00 SET     写 [5:0]，该优先级就绪
+//   0x04 CLR     写 [5:0]，该优先级不再就绪
+//   0x08 HIGH    只读，[5:0] 就绪的最高优先级（数值最小），[31] NONE 为 1 表示没有就绪的优先级
+//   0x10 RDY_LO  优先级 0 ~ 31 的就绪位，可以读写
+//   0x14 RDY_HI  优先级 32 ~ 63 的就绪位，可以读写
+//   0x400 ~ 0x7FC UNMAP  只读，地址的 [9:2] 为 x，读出 x 中最低的 1 的位置，x 为 0 时读出 0，
+//                与 OSUnMapTbl[x] 相同
+module wb_rdylist(
+    // Wishbone 总线接口
+    input wire        wb_clk_i,        // Wishbone 时钟
+    input wire        wb_rst_i,        // Wishbone 复位
+    input wire        wb_cyc_i,        // Wishbone 总线周期有效
+    input wire        wb_stb_i,        // Wishbone 选通信号
+    input wire        wb_we_i,         // Wishbone 写使能
+    input wire [3:0]  wb_sel_i,        // Wishbone 字节选择
+    input wire [31:0] wb_adr_i,        // Wishbone 地址
+    input wire [31:0] wb_dat_i,        // Wishbone 写数据
+    output reg [31:0] wb_dat_o,        // Wishbone 读数据
+    output reg        wb_ack_o         // Wishbone 应答
+    );
+
+reg [63:0]  rdy;
+
+// 最低的 1 的位置，从高位往低位扫描，最后一个为 1 的位置就是结果；全 0 时为 0
+function [5:0] ffs64;
+    input [63:0] v;
+    integer      k;
+    begin
+        ffs64 = 6'd0;
+        for(k = 63; k >= 0; k = k - 1) begin
+            if(v[k]) begin
+                ffs64 = k;
+            end
+        end
+    end
+endfunction
+
+wire        req       = wb_cyc_i & wb_stb_i & ~wb_ack_o;
+wire        unmap_sel = wb_adr_i[10];
+wire [2:0]  reg_idx   = wb_adr_i[4:2];
+wire [5:0]  high      = ffs64(rdy);
+wire [5:0]  unmap     = ffs64({56'h00000000000000, wb_adr_i[9:2]});
+
+// 寄存器访问，应答只保持一个周期
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        rdy      <= 64'h0000000000000000;
+        wb_ack_o <= 1'b0;
+        wb_dat_o <= 32'h00000000;
+    end
+    else begin
+        wb_ack_o <= req;
+        if(req & wb_we_i & ~unmap_sel) begin
+            case(reg_idx)
+            3'd0:    rdy[wb_dat_i[5:0]] <= 1'b1;
+            3'd1:    rdy[wb_dat_i[5:0]] <= 1'b0;
+            3'd4:    rdy[31:0]          <= wb_dat_i;
+            3'd5:    rdy[63:32]         <= wb_dat_i;
+            default: ;
+            endcase
+        end
+        if(req) begin
+            if(unmap_sel) begin
+                wb_dat_o <= {26'h0000000, unmap};
+            end
+            else begin
+                case(reg_idx)
+                3'd2:    wb_dat_o <= {(rdy == 64'h0000000000000000), 25'h0000000, high};
+                3'd4:    wb_dat_o <= rdy[31:0];
+                3'd5:    wb_dat_o <= rdy[63:32];
+                default: wb_dat_o <= 32'h00000000;
+                endcase
+            end
+        end
+    end
+end
+
+endmodule
@@ -0,0 +1,156 @@
+`timescale 1ns / 1ps
+
+// 多通道定时器：挂在总线互联的从设备接口 9（0x90000000），与 CP0 的 Count/Compare 无关
+// 包括一个 64 位自由运行的时间戳计数器和 CH_NUM 个 64 位减计数通道，每个通道有自己的
+// 中断输出，连接到中断控制器。通道的 LOAD_HI 复位后为 0，只写 LOAD_LO 就是 32 位定时器
+//
+// 寄存器（都按字访问）：
+//   0x00 TS_LO    时间戳的低 32 位，读它的同时锁存高 32 位
+//   0x04 TS_HI    上一次读 TS_LO 时锁存的高 32 位，先读 TS_LO 再读 TS_HI 得到一致的 64 位值
+//   0x08 STATUS   [i] 通道 i 计数到期，写 1 清零
+//   0x20 + i * 0x20 通道 i：
+//     +0x00 CTRL      [0] EN 为 1 时计数，写 CTRL 且 EN 为 1 时从 LOAD 重新开始
+//                     [1] ONESHOT 为 1 时到期后 EN 自动清零，为 0 时自动重装、周期运行
+//                     [2] IE 为 1 时 STATUS 的对应位请求中断
+//     +0x04 LOAD_LO   周期的低 32 位，单位是时钟周期，每 LOAD 个周期到期一次，LOAD 不能为 0
+//     +0x08 LOAD_HI   周期的高 32 位
+//     +0x0C COUNT_LO  当前计数值的低 32 位（到 0 时到期），读它的同时锁存高 32 位
+//     +0x10 COUNT_HI  上一次读 COUNT_LO 时锁存的高 32 位
+module wb_timer #(
+    parameter CH_NUM = 4                 // 通道数，最多 7 个
+)(
+    // Wishbone 总线接口
+    input wire        wb_clk_i,        // Wishbone 时钟
+    input wire        wb_rst_i,        // Wishbone 复位
+    input wire        wb_cyc_i,        // Wishbone 总线周期有效
+    input wire        wb_stb_i,        // Wishbone 选通信号
+    input wire        wb_we_i,         // Wishbone 写使能
+    input wire [3:0]  wb_sel_i,        // Wishbone 字节选择
+    input wire [31:0] wb_adr_i,        // Wishbone 地址
+    input wire [31:0] wb_dat_i,        // Wishbone 写数据
+    output reg [31:0] wb_dat_o,        // Wishbone 读数据
+    output reg        wb_ack_o,        // Wishbone 应答
+
+    output wire [CH_NUM - 1:0] int_o   // 每个通道一个中断请求，高电平有效
+    );
+
+reg [63:0]          ts;
+reg [31:0]          ts_hi;             // 读 TS_LO 时锁存的高 32 位
+reg [CH_NUM - 1:0]  status;
+
+reg [2:0]           ctrl[0:CH_NUM - 1];
+reg [63:0]          load[0:CH_NUM - 1];
+reg [63:0]          cnt[0:CH_NUM - 1];
+reg [31:0]          cnt_hi;            // 读 COUNT_LO 时锁存的高 32 位，各通道共用
+
+wire        req     = wb_cyc_i & wb_stb_i & ~wb_ack_o;
+wire [2:0]  reg_blk = wb_adr_i[7:5];   // 0 为全局寄存器，1 ~ CH_NUM 为通道 0 ~ CH_NUM-1
+wire [2:0]  reg_idx = wb_adr_i[4:2];
+wire [2:0]  reg_ch  = reg_blk - 3'd1;
+wire        ch_sel  = (reg_blk != 3'd0) && (reg_blk <= CH_NUM);
+wire        ctrl_we = req & wb_we_i & ch_sel & (reg_idx == 3'd0);
+
+integer i;
+
+genvar g;
+generate
+for(g = 0; g < CH_NUM; g = g + 1) begin : irq
+    assign int_o[g] = status[g] & ctrl[g][2];
+end
+endgenerate
+
+// 时间戳和各通道的计数，写 CTRL 启动通道时从 LOAD 开始
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        ts     <= 64'h0000000000000000;
+        status <= {CH_NUM{1'b0}};
+        for(i = 0; i < CH_NUM; i = i + 1) begin
+            ctrl[i] <= 3'b000;
+            cnt[i]  <= 64'h0000000000000000;
+        end
+    end
+    else begin
+        ts <= ts + 64'd1;
+        for(i = 0; i < CH_NUM; i = i + 1) begin
+            if(ctrl_we && (reg_ch == i)) begin
+                ctrl[i] <= wb_dat_i[2:0];
+                cnt[i]  <= load[i] - 64'd1;
+            end
+            else if(ctrl[i][0]) begin
+                if(cnt[i] == 64'h0000000000000000) begin
+                    cnt[i] <= load[i] - 64'd1;
+                    if(ctrl[i][1]) begin
+                        ctrl[i][0] <= 1'b0;
+                    end
+                end
+                else begin
+                    cnt[i] <= cnt[i] - 64'd1;
+                end
+            end
+        end
+        // 新的到期优先于同一个周期的清零
+        for(i = 0; i < CH_NUM; i = i + 1) begin
+            if(ctrl[i][0] && !(ctrl_we && (reg_ch == i)) && (cnt[i] == 64'h0000000000000000)) begin
+                status[i] <= 1'b1;
+            end
+            else if(req && wb_we_i && (reg_blk == 3'd0) && (reg_idx == 3'd2) && wb_dat_i[i]) begin
+                status[i] <= 1'b0;
+            end
+        end
+    end
+end
+
+// 寄存器访问，应答只保持一个周期
+always @ (posedge wb_clk_i or posedge wb_rst_i) begin
+    if(wb_rst_i) begin
+        for(i = 0; i < CH_NUM; i = i + 1) begin
+            load[i] <= 64'h0000000000000000;
+        end
+        ts_hi    <= 32'h00000000;
+        cnt_hi   <= 32'h00000000;
+        wb_ack_o <= 1'b0;
+        wb_dat_o <= 32'h00000000;
+    end
+    else begin
+        wb_ack_o <= req;
+        if(req & wb_we_i & ch_sel) begin
+            if(reg_idx == 3'd1) begin
+                load[reg_ch][31:0]  <= wb_dat_i;
+            end
+            else if(reg_idx == 3'd2) begin
+                load[reg_ch][63:32] <= wb_dat_i;
+            end
+        end
+        if(req) begin
+            wb_dat_o <= 32'h00000000;
+            if(reg_blk == 3'd0) begin
+                case(reg_idx)
+                3'd0:
+                begin
+                    wb_dat_o <= ts[31:0];
+                    ts_hi    <= ts[63:32];
+                end
+                3'd1:    wb_dat_o <= ts_hi;
+                3'd2:    wb_dat_o <= {{(32 - CH_NUM){1'b0}}, status};
+                default: wb_dat_o <= 32'h00000000;
+                endcase
+            end
+            else if(ch_sel) begin
+                case(reg_idx)
+                3'd0:    wb_dat_o <= {29'h00000000, ctrl[reg_ch]};
+                3'd1:    wb_dat_o <= load[reg_ch][31:0];
+                3'd2:    wb_dat_o <= load[reg_ch][63:32];
+                3'd3:
+                begin
+                    wb_dat_o <= cnt[reg_ch][31:0];
+                    cnt_hi   <= cnt[reg_ch][63:32];
+                end
+                3'd4:    wb_dat_o <= cnt_hi;
+                default: wb_dat_o <= 32'h00000000;
+                endcase
+            end
+        end
+    end
+end
+
+endmodule
@@ -7,15 +7,8 @@
 #define BOARD_SIZE 4
 
 int board[BOARD_SIZE][BOARD_SIZE];
+INT32U score;               /* 得分：每次合并得到的新数字之和，显示在数码管上 */ 
 
-#define BOTH_EMPTY (UART_LS_TEMT | UART_LS_THRE) 
-
-/* 循环等待，直到 UART 控制器的发送 FIFO 为空、移位寄存器为空，表示数据发送完毕 */ 
-#define WAIT_FOR_XMITR \
-        do { \
-                lsr = REG8(UART_BASE + UART_LS_REG); \
-        } while ((lsr & BOTH_EMPTY) != BOTH_EMPTY)
- 
 /* 循环等待，直到 UART 控制器发送 FIFO 为空，此时不一定发送完毕，但是可以接着通过 
 UART控制器发送数据 */ 
 #define WAIT_FOR_THRE \
@@ -24,9 +17,46 @@ UART控制器发送数据 */
         } while ((lsr & UART_LS_THRE) != UART_LS_THRE)
  
 /* 给用户任务使用的堆栈，大小是 256 个字，其中 OS_STK 就是 int 类型，其在 os_cpu.h  
-中定义 */ 
+中定义。堆栈放在 DTCM 中，任务切换时保存、恢复现场不需要访问总线 */ 
 #define TASK_STK_SIZE 256 
-OS_STK TaskStartStk[TASK_STK_SIZE]; 
+OS_STK TaskStartStk[TASK_STK_SIZE] OS_DTCM_BSS; 
+
+/* 串口按键任务只是转发字符，堆栈小一些。嵌套的中断都在中断堆栈 OSCPUIntStk 上保存现场， 
+任务堆栈只需要留出一个现场的空间 */ 
+#define TASK_KEY_STK_SIZE 128 
+OS_STK TaskKeyStk[TASK_KEY_STK_SIZE] OS_DTCM_BSS; 
+
+/* 走法队列：N17 按下时 GPIO 中断处理函数放入当时的输入值，TaskKey 把串口输入的 
+w/s/a/d 转换成同样的格式放入，游戏任务挂起在队列上，直到有走法到达 */ 
+#define MOVE_Q_SIZE 8 
+static void *move_q_tbl[MOVE_Q_SIZE]; 
+static OS_EVENT *move_q; 
+ 
+/* 发送环形缓冲区：任务把字符放进来就返回，由 UART 的发送 FIFO 空中断每次取出最多 
+UART_FIFO_DEPTH 个字符写入发送 FIFO。大小必须是 2 的幂 */ 
+#define UART_TX_RING_SIZE 512 
+static char uart_tx_ring[UART_TX_RING_SIZE]; 
+static volatile INT32U uart_tx_head;     /* 下一个放入的位置，只由任务修改 */ 
+static volatile INT32U uart_tx_tail;     /* 下一个取出的位置，只由中断处理函数修改 */ 
+
+/* 环形缓冲区满时任务挂起在 uart_tx_space 上，中断处理函数取出字符之后释放 */ 
+static OS_EVENT *uart_tx_space; 
+static volatile INT8U uart_tx_waiting; 
+
+/* 接收环形缓冲区：中断处理函数把接收 FIFO 中的字节全部取出放进来，每次中断只释放一次 
+uart_rx_sem，任务被唤醒后一次取走所有已到达的字节。大小必须是 2 的幂 */ 
+#define UART_RX_RING_SIZE 128 
+static char uart_rx_ring[UART_RX_RING_SIZE]; 
+static volatile INT32U uart_rx_head;     /* 下一个放入的位置，只由中断处理函数修改 */ 
+static volatile INT32U uart_rx_tail;     /* 下一个取出的位置，只由任务修改 */ 
+static volatile INT32U uart_rx_overrun;  /* 缓冲区满丢弃的字节数 */ 
+static OS_EVENT *uart_rx_sem; 
+
+/* Interrupt Enable 寄存器的副本，发送、接收共用，只在临界区中修改 */ 
+static INT8U uart_ier; 
+
+/* 保证一个字符串输出完毕之前不会插入其它任务的输出 */ 
+static OS_EVENT *uart_tx_sem; 
  
 /* 要通过 UART 发送的字符串 */ 
 // char Info[103]={0xC9,0xCF,0xB5,0xDB,0xCB,0xB5,0xD2,0xAA,0xD3,0xD0,0xB9,0xE2,0xA3,0xAC,0xD3,0xDA,0xCA,0xC7,0xBE,0xCD,0xD3,0xD0,0xC1,0xCB,0xB9,0xE2,0x0D,0x0A,0xC9,0xCF,0xB5,0xDB,0xCB,0xB5,0xD2,0xAA,0xD3,0xD0,0xCC,0xEC,0xBF,0xD5,0xA3,0xAC,0xD3,0xDA,0xCA,0xC7,0xBE,0xCD,0xD3,0xD0,0xC1,0xCB,0xCC,0xEC,0xBF,0xD5,0x0D,0x0A,0xC9,0xCF,0xB5,0xDB,0xCB,0xB5,0xD2,0xAA,0xD3,0xD0,0xC2,0xBD,0xB5,0xD8,0xBA,0xCD,0xBA,0xA3,0xD1,0xF3,0xA3,0xAC,0xD3,0xDA,0xCA,0xC7,0xBE,0xCD,0xD3,0xD0,0xC1,0xCB,0xC2,0xBD,0xB5,0xD8,0xBA,0xCD,0xBA,0xA3,0xD1,0xF3,0x0D};
@@ -48,8 +78,24 @@ void uart_init(void)             /* UART 控制器初始化函数 */
                 REG8(UART_BASE + UART_DLB2_REG) = (divisor >> 8) & 0x000000ff; 
         REG8(UART_BASE + UART_LC_REG)   = 0x00; 
 
-        /* 禁止 UART 控制器的所有中断 */ 
-        REG8(UART_BASE + UART_IE_REG) = 0x00; 
+        uart_tx_sem     = OSSemCreate(1); 
+        uart_tx_space   = OSSemCreate(0); 
+        uart_tx_head    = 0; 
+        uart_tx_tail    = 0; 
+        uart_tx_waiting = 0; 
+        uart_rx_sem     = OSSemCreate(0); 
+        uart_rx_head    = 0; 
+        uart_rx_tail    = 0; 
+        uart_rx_overrun = 0; 
+
+        /* 清空两个 FIFO，接收 FIFO 中有 8 个字节或者超时才产生中断，连续输入的一串 
+        字符只需要少数几次中断 */ 
+        REG8(UART_BASE + UART_FC_REG) = UART_FC_TRIG_8 | UART_FC_CLR_RX | UART_FC_CLR_TX; 
+
+        /* 使能接收中断（包括超时中断），有字符要发送时再使能发送 FIFO 空中断 */ 
+        uart_ier = UART_IE_RDA; 
+        REG8(UART_BASE + UART_IE_REG) = uart_ier; 
+        pic_attach(UART_PIC_SRC, UART_PIC_PRIO, 0, uart_isr); 
 
         /* 设置数据格式：8 位数据位、1 位停止位、没有奇偶校验位 */ 
         REG8(UART_BASE + UART_LC_REG) = UART_LC_WLEN8 | (UART_LC_ONE_STOP | UART_LC_NO_PARITY);
@@ -59,41 +105,185 @@ void uart_init(void)             /* UART 控制器初始化函数 */
         return; 
 }
 
-void uart_putc(char c)            /* 通过 UART 输出字节 */ 
+/* 把一个字符放入发送环形缓冲区。在任务中调用时，缓冲区满就挂起等待；在中断处理 
+函数中调用时不能挂起，缓冲区满就丢弃 */ 
+static void uart_tx_put(char c) 
+{ 
+    INT8U  err; 
+#if OS_CRITICAL_METHOD == 3 
+    OS_CPU_SR  cpu_sr = 0; 
+#endif 
+
+    for(;;) 
+    { 
+        OS_ENTER_CRITICAL(); 
+        if(uart_tx_head - uart_tx_tail < UART_TX_RING_SIZE) 
+            break; 
+        if(OSIntNesting > 0) 
+        { 
+            OS_EXIT_CRITICAL(); 
+            return; 
+        } 
+        uart_tx_waiting = 1; 
+        OS_EXIT_CRITICAL(); 
+        OSSemPend(uart_tx_space, 0, &err); 
+    } 
+
+    uart_tx_ring[uart_tx_head & (UART_TX_RING_SIZE - 1)] = c; 
+    uart_tx_head++; 
+
+    /* 发送 FIFO 空中断原来是禁止的，说明发送已经停止，重新使能就会马上产生中断 */ 
+    if((uart_ier & UART_IE_THRE) == 0) 
+    { 
+        uart_ier |= UART_IE_THRE; 
+        REG8(UART_BASE + UART_IE_REG) = uart_ier; 
+    } 
+    OS_EXIT_CRITICAL(); 
+} 
+
+/* OS 启动之前中断还没有打开，直接查询发送 FIFO 空标志输出 */ 
+static void uart_tx_poll(char c) 
 { 
     unsigned char lsr; 
     WAIT_FOR_THRE;            /* 等待发送 FIFO 空 */ 
     REG8(UART_BASE + UART_TH_REG) = c;   /* 通过 UART 输出字节 */ 
-    if(c == '\n') {           /* 如果是换行符，那么增加一个回车符 */ 
-        WAIT_FOR_THRE; 
-        REG8(UART_BASE + UART_TH_REG) = '\r';  /* 通过 UART 输出回车符 */ 
+} 
+
+void uart_putc(char c)            /* 通过 UART 输出字节 */ 
+{ 
+    if(OSRunning == OS_TRUE) { 
+        uart_tx_put(c); 
+        if(c == '\n')            /* 如果是换行符，那么增加一个回车符 */ 
+            uart_tx_put('\r'); 
+    } else { 
+        uart_tx_poll(c); 
+        if(c == '\n') 
+            uart_tx_poll('\r'); 
     } 
-    WAIT_FOR_XMITR;           /* 等待发送数据完毕 */ 
 } 
  
 void uart_print_str(char* str)    /* 通过 UART 输出字符串 */ 
 { 
     INT32U i=0; 
-    OS_CPU_SR cpu_sr; 
-    OS_ENTER_CRITICAL()        /*不希望输出字符串的过程被打断，所以进入临界区 */ 
+    INT8U  err; 
+    INT8U  lock = (OSRunning == OS_TRUE) && (OSIntNesting == 0); 
+
+    /* 不希望输出字符串的过程被其它任务打断。字符只是放入环形缓冲区，不必关中断， 
+    缓冲区满时挂起，CPU 可以执行其它任务 */ 
+    if(lock) 
+        OSSemPend(uart_tx_sem, 0, &err); 
     
     while(str[i]!=0) 
     { 
-        uart_putc(str[i]);      /* 调用函数 uart_putc 依次输出每个字节 */ 
+        uart_putc(str[i]); 
         i++; 
     } 
         
-    OS_EXIT_CRITICAL()         /* 输出字符串结束，退出临界区 */ 
+    if(lock) 
+        OSSemPost(uart_tx_sem);  /* 输出字符串结束 */ 
 }
 
+/* 从 UART 读一个字节。timeout 是最多等待的 Tick 数，为 0 表示一直等待，超时返回 -1。 
+只能在任务中调用 */ 
+INT16S uart_getc(INT16U timeout) 
+{ 
+    INT8U  err; 
+    INT16S c; 
+#if OS_CRITICAL_METHOD == 3 
+    OS_CPU_SR  cpu_sr = 0; 
+#endif 
+
+    for(;;) 
+    { 
+        OS_ENTER_CRITICAL(); 
+        if(uart_rx_tail != uart_rx_head) 
+        { 
+            c = (INT8U)uart_rx_ring[uart_rx_tail & (UART_RX_RING_SIZE - 1)]; 
+            uart_rx_tail++; 
+            OS_EXIT_CRITICAL(); 
+            return c; 
+        } 
+        OS_EXIT_CRITICAL(); 
+
+        /* 缓冲区已空，等待下一次接收中断。信号量可能是之前一批字节留下的，被唤醒后 
+        缓冲区仍可能是空的，所以要重新检查 */ 
+        OSSemPend(uart_rx_sem, timeout, &err); 
+        if(err == OS_ERR_TIMEOUT) 
+            return -1; 
+    } 
+} 
+
+void uart_isr(void)               /* UART 中断处理函数，由 pic_dispatch 调用 */ 
+{ 
+    INT8U  iir; 
+    INT32U n; 
+
+    /* 读 Interrupt Identification 寄存器，同时清除发送 FIFO 空中断。一次只处理优先级 
+    最高的中断来源，其余来源仍然有效，返回之后会再次进入 */ 
+    iir = REG8(UART_BASE + UART_II_REG); 
+    if((iir & UART_II_NO_INT) != 0) 
+        return; 
+
+    if((iir & UART_II_MASK) == UART_II_RDA || (iir & UART_II_MASK) == UART_II_TI) 
+    { 
+        /* 取出接收 FIFO 中的所有字节，读空之后两种中断都会撤销 */ 
+        n = 0; 
+        while((REG8(UART_BASE + UART_LS_REG) & UART_LS_DR) != 0) 
+        { 
+            if(uart_rx_head - uart_rx_tail < UART_RX_RING_SIZE) 
+            { 
+                uart_rx_ring[uart_rx_head & (UART_RX_RING_SIZE - 1)] = REG8(UART_BASE + UART_RB_REG); 
+                uart_rx_head++; 
+                n++; 
+            } 
+            else 
+            { 
+                (void)REG8(UART_BASE + UART_RB_REG);   /* 缓冲区满，丢弃 */ 
+                uart_rx_overrun++; 
+            } 
+        } 
+        if(n > 0) 
+            OSSemPost(uart_rx_sem);       /* 一批字节只唤醒一次等待的任务 */ 
+    } 
+    else if((iir & UART_II_MASK) == UART_II_THRE) 
+    { 
+        /* 发送 FIFO 已空，一次最多写入 UART_FIFO_DEPTH 个字符 */ 
+        for(n = 0; n < UART_FIFO_DEPTH && uart_tx_tail != uart_tx_head; n++) 
+        { 
+            REG8(UART_BASE + UART_TH_REG) = uart_tx_ring[uart_tx_tail & (UART_TX_RING_SIZE - 1)]; 
+            uart_tx_tail++; 
+        } 
+
+        /* 缓冲区已取空，禁止发送 FIFO 空中断，下次放入字符时再使能 */ 
+        if(uart_tx_tail == uart_tx_head) 
+        { 
+            uart_ier &= ~UART_IE_THRE; 
+            REG8(UART_BASE + UART_IE_REG) = uart_ier; 
+        } 
+
+        if(n > 0 && uart_tx_waiting) 
+        { 
+            uart_tx_waiting = 0; 
+            OSSemPost(uart_tx_space);     /* 唤醒等待缓冲区空间的任务 */ 
+        } 
+    } 
+} 
+
 /**************************************************************** 
 ***********        第三段：与 GPIO 模块相关的函数定义      ********** 
 *****************************************************************/ 
  
-void gpio_init()                  /* GPIO 模块初始化函数 */ 
+void gpio_init()                  /* GPIO 模块初始化函数，需要在 OSInit 之后调用 */ 
 { 
+        move_q = OSQCreate(&move_q_tbl[0], MOVE_Q_SIZE); 
+
         REG32(GPIO_BASE + GPIO_OE_REG) = 0xffffffff;   /* 所有输出端口使能*/ 
-        REG32(GPIO_BASE + GPIO_INTE_REG) = 0x00000000; /* 禁用所有中断*/ 
+        /* 只有 N17 按下（上升沿）时产生中断，Status 寄存器在 OSInitTick 中打开中断 */ 
+        REG32(GPIO_BASE + GPIO_PTRIG_REG) = GPIO_KEY_CONFIRM; 
+        REG32(GPIO_BASE + GPIO_INTS_REG)  = 0x00000000; 
+        REG32(GPIO_BASE + GPIO_INTE_REG)  = GPIO_KEY_CONFIRM; 
+        REG32(GPIO_BASE + GPIO_CTRL_REG)  = GPIO_CTRL_INTE; 
+        pic_attach(GPIO_PIC_SRC, GPIO_PIC_PRIO, 0, gpio_isr); 
         gpio_out(0x0f0f0f0f);                          /* 输出 0x0f0f0f0f*/ 
  
        /* 通过 UART 输出 GPIO 模块初始化完毕信息 */ 
@@ -113,22 +303,99 @@ INT32U gpio_in()                  /* 读取 GPIO 模块输入的函数 */
     return temp; 
 }
 
+/* 下面几个函数通过输出寄存器的置位、清零、取反别名修改输出，每次只有一个写操作，由硬件 
+完成读-改-写，多个任务、中断处理函数同时修改不同的位也不需要关中断 */ 
+void gpio_set(INT32U mask) 
+{ 
+    REG32(GPIO_BASE + GPIO_OUT_SET_REG) = mask; 
+} 
+
+void gpio_clr(INT32U mask) 
+{ 
+    REG32(GPIO_BASE + GPIO_OUT_CLR_REG) = mask; 
+} 
+
+void gpio_toggle(INT32U mask) 
+{ 
+    REG32(GPIO_BASE + GPIO_OUT_TGL_REG) = mask; 
+} 
+
+/* 把 mask 指定的字段改为 value（已经移到字段所在的位置）。字段中要变化的位分别置位、清零， 
+中间状态只是部分位已经更新，不会影响字段以外的位 */ 
+void gpio_write_field(INT32U mask, INT32U value) 
+{ 
+    gpio_clr(mask & ~value); 
+    gpio_set(mask & value); 
+} 
+
+void gpio_isr(void)               /* GPIO 中断处理函数，由 pic_dispatch 调用 */ 
+{ 
+    INT32U ints; 
+
+    /* 读出中断状态并清零，撤销中断请求。只使能了 N17 一个输入的中断，清零时不会 
+    丢掉其它输入的边沿 */ 
+    ints = REG32(GPIO_BASE + GPIO_INTS_REG); 
+    REG32(GPIO_BASE + GPIO_INTS_REG) = 0x00000000; 
+
+    /* 按键按下时拨动开关已经稳定，连同确认位一起放入走法队列，队列满时丢弃 */ 
+    if((ints & GPIO_KEY_CONFIRM) != 0) 
+        OSQPost(move_q, (void *)(REG32(GPIO_BASE + GPIO_IN_REG) | GPIO_KEY_CONFIRM)); 
+}
+
+void seg7_init(void)              /* 数码管控制器初始化函数 */ 
+{ 
+    seg7_show_hex(0); 
+    REG32(SEG7_BASE + SEG7_CTRL_REG) = SEG7_CTRL_EN | SEG7_CTRL_LZB; 
+} 
+
+/* 把 num 转换为 8 位 BCD 码，配合 SEG7_CTRL_LZB 就是不带前导 0 的十进制显示 */ 
+INT32U seg7_bcd(INT32U num) 
+{ 
+    INT32U bcd = 0; 
+    INT32U shift; 
+
+    if(num > 99999999) 
+        num = 99999999; 
+    for(shift = 0; num != 0; shift += 4) { 
+        bcd |= (num % 10) << shift; 
+        num /= 10; 
+    } 
+    return bcd; 
+} 
+
 /**************************************************************** 
 ***********             第四段：定时器初始化函数           ********* 
 *****************************************************************/ 
  
+static void tick_isr(void)        /* 时钟节拍中断处理函数，由 pic_dispatch 调用 */ 
+{ 
+    timer_ack(TIMER_CH_TICK);     /* 清除到期标志，撤销中断请求 */ 
+    OSTimeTick();                 /* 通知操作系统有一个时钟节拍 */ 
+} 
+
+#if OS_TMR_EN > 0u 
+static void ostmr_isr(void)       /* 软件定时器中断处理函数，唤醒 OSTmr 任务 */ 
+{ 
+    timer_ack(TIMER_CH_OSTMR); 
+    OSTmrSignal(); 
+} 
+#endif 
+
 void OSInitTick(void) 
 { 
     /* 每个 Tick 代表一个时钟节拍，会引发一次中断，依据每秒有多少个 Tick，计算 
-    Compare 寄存器的初值 */ 
-    INT32U compare = (INT32U)(IN_CLK / OS_TICKS_PER_SEC); 
-     
-    /* 清零 Count 寄存器、设置 Compare 寄存器 */ 
-    asm volatile("mtc0 %0,$9"  : :"r"(0x0));  
-    asm volatile("mtc0 %0,$11" : :"r"(compare));   
- 
-    /* 设置 Status 寄存器，以使能时钟中断 */ 
-    asm volatile("mtc0 %0,$12" : :"r"(0x10000401)); 
+    定时器通道的周期，通道自动重装，不需要在中断处理函数中重新设置 */ 
+    pic_attach(TIMER_PIC_SRC(TIMER_CH_TICK), TICK_PIC_PRIO, 0, tick_isr); 
+    timer_start(TIMER_CH_TICK, IN_CLK / OS_TICKS_PER_SEC, TIMER_CTRL_IE); 
+
+    /* 软件定时器的节拍由另一个通道产生，频率为 OS_TMR_CFG_TICKS_PER_SEC */ 
+#if OS_TMR_EN > 0u 
+    pic_attach(TIMER_PIC_SRC(TIMER_CH_OSTMR), OSTMR_PIC_PRIO, 0, ostmr_isr); 
+    timer_start(TIMER_CH_OSTMR, IN_CLK / OS_TMR_CFG_TICKS_PER_SEC, TIMER_CTRL_IE); 
+#endif 
+
+    /* 所有中断都经过中断控制器，设置 Status 寄存器，只使能中断控制器的中断 */ 
+    asm volatile("mtc0 %0,$12" : :"r"(0x10000001 | PIC_INT_MASK)); 
  
     return;
 } 
@@ -177,6 +444,7 @@ void init_board(void) {
             board[i][j] = 0;
         }
     }
+    score = 0;
     add_new_tile();
     add_new_tile();
 }
@@ -243,6 +511,7 @@ int move_left(void) {
                     } else if (board[i][k - 1] == board[i][k]) {
                         // Merge with the left tile
                         board[i][k - 1] *= 2;
+                        score += board[i][k - 1];
                         board[i][k] = 0;
                         moved = 1;
                         break; // Stop moving this tile
@@ -276,6 +545,7 @@ int move_right(void) {
                     } else if (board[i][k + 1] == board[i][k]) { // 如果右边是相同数字
                         // 合并
                         board[i][k + 1] *= 2;
+                        score += board[i][k + 1];
                         board[i][k] = 0;
                         moved = 1;
                         break; // 合并后，此方块移动结束
@@ -309,6 +579,7 @@ int move_up(void) {
                     } else if (board[k - 1][j] == board[k][j]) { // 如果上方是相同数字
                         // 合并
                         board[k - 1][j] *= 2;
+                        score += board[k - 1][j];
                         board[k][j] = 0;
                         moved = 1;
                         break; // 合并后，此方块移动结束
@@ -342,6 +613,7 @@ int move_down(void) {
                     } else if (board[k + 1][j] == board[k][j]) { // 如果下方是相同数字
                         // 合并
                         board[k + 1][j] *= 2;
+                        score += board[k + 1][j];
                         board[k][j] = 0;
                         moved = 1;
                         break; // 合并后，此方块移动结束
@@ -368,18 +640,49 @@ int is_game_over(void) {
     return 1;
 }
 
+/* 串口按键任务：把 w/s/a/d 转换成与 GPIO 输入相同的格式（第 4~1bit 为方向，第 0bit 
+为确认）放入走法队列，其它字符忽略 */ 
+void  TaskKey (void *pdata) 
+{ 
+    INT16S key; 
+    INT32U choice; 
+    pdata = pdata; 
+
+    for (;;) { 
+        key = uart_getc(0);     /* 一直挂起，直到串口收到字符 */ 
+        if (key == 'w')      choice = 0x8; 
+        else if (key == 's') choice = 0x4; 
+        else if (key == 'a') choice = 0x2; 
+        else if (key == 'd') choice = 0x1; 
+        else continue; 
+
+        OSQPost(move_q, (void *)((choice << 1) | GPIO_KEY_CONFIRM)); 
+    } 
+} 
+
 void  TaskStart (void *pdata) 
 { 
     INT32U count = 0; 
     INT32U data;
     INT32U moved;
+    INT8U  err;
     pdata = pdata; 
     OSInitTick();       /* 在用户任务中初始化定时器、允许时钟中断 */  
 
+#if SCHED_BENCH_EN
+    sched_bench();      /* 比较就绪表的几种实现，见 os_cpu.h 的 OS_CPU_RDY_METHOD */
+#endif
+#if ISR_BENCH_EN
+    isr_bench();        /* 不切换任务时一次中断的开销，见 os_cpu_a.S 的 InterruptHandler */
+#endif
+
+    perf_start();       /* 统计一局游戏中各个从设备的总线访问，结束时输出 */ 
+
     init_board();
     uart_print_str("Welcome to 2048!\n");
     print_board();
     uart_print_str("Use switches to move left, right, up, down. Press N17 to confirm.\n");
+    uart_print_str("Or type w/s/a/d on the serial console.\n");
 
     for (;;) {            /* 一般而言，任务都是一个永不结束的循环 */ 
         // if(count <= 102) 
@@ -390,51 +693,51 @@ void  TaskStart (void *pdata)
         // gpio_out(count);  /* 通过 GPIO 输出 count 的值 */ 
         // count = count + 2;    /* count 的值加 2 */ 
         // OSTimeDly(10);    /* 等待 10 个 Tick 后，再次执行该任务 */ 
-        data = gpio_in();
-        INT32U ready = data << 31; // 也就是只判断这一位，因为移出来的都是 0
+        /* 挂起等待下一个走法，CPU 可以去执行空闲任务和统计任务 */
+        data = (INT32U)OSQPend(move_q, 0, &err);
         INT32U choice = data >> 1;
-        
-        if (ready) {
-            moved = 0;
 
-            INT32U up = (choice & 0x0000000F) == 0x00000008;
-            INT32U down = (choice & 0x0000000F) == 0x00000004;
-            INT32U left = (choice & 0x0000000F) == 0x00000002;
-            INT32U right = (choice & 0x0000000F) == 0x00000001;
+        moved = 0;
 
-            if (up) {
-                uart_print_str("Your choice is: up\n");
-                moved = move_up();
-            }
-            else if (down) {
-                uart_print_str("Your choice is: down\n");
-                moved = move_down();
-            }
-            else if (left) {
-                uart_print_str("Your choice is: left\n");
-                moved = move_left();
-            }
-            else if (right) {
-                uart_print_str("Your choice is: right\n");
-                moved = move_right();
-            }
-            else {
-                uart_print_str("Invalid move!\n");
-                continue;
-            }
+        INT32U up = (choice & 0x0000000F) == 0x00000008;
+        INT32U down = (choice & 0x0000000F) == 0x00000004;
+        INT32U left = (choice & 0x0000000F) == 0x00000002;
+        INT32U right = (choice & 0x0000000F) == 0x00000001;
 
-            if (moved) {
-                add_new_tile();
-            }
+        if (up) {
+            uart_print_str("Your choice is: up\n");
+            moved = move_up();
+        }
+        else if (down) {
+            uart_print_str("Your choice is: down\n");
+            moved = move_down();
+        }
+        else if (left) {
+            uart_print_str("Your choice is: left\n");
+            moved = move_left();
+        }
+        else if (right) {
+            uart_print_str("Your choice is: right\n");
+            moved = move_right();
+        }
+        else {
+            uart_print_str("Invalid move!\n");
+            continue;
+        }
 
-            print_board();
-            
-            if (is_game_over()) {
-                uart_print_str("Game Over!\n");
-                break; // 结束游戏
-            } else {
-                uart_print_str("Enter move...\n");
-            }
+        if (moved) {
+            add_new_tile();
+        }
+
+        print_board();
+        seg7_show_hex(seg7_bcd(score));   /* 一条 sw 更新数码管上的得分 */ 
+        
+        if (is_game_over()) {
+            uart_print_str("Game Over!\n");
+            perf_dump();
+            break; // 结束游戏
+        } else {
+            uart_print_str("Enter move...\n");
         }
         count = count + 1;
     }
@@ -448,12 +751,23 @@ void main()
 { 
     OSInit();                  /* µC/OS-II 初始化 */ 
 
+    pic_init();                /* 中断控制器初始化，各个外设初始化时挂接中断处理函数 */ 
+
+    timer_init();              /* 定时器初始化，时钟节拍在 OSInitTick 中启动 */ 
+
+    dma_init();                /* DMA 控制器初始化 */ 
+
+    crc_init();                /* CRC 计算单元初始化 */ 
+
     uart_init();               /* UART 控制器初始化 */ 
 
     gpio_init();               /* GPIO 模块初始化 */ 
 
+    seg7_init();               /* 数码管控制器初始化 */ 
+
     /* 创建用户任务 */ 
     OSTaskCreate(TaskStart, (void *)0, &TaskStartStk[TASK_STK_SIZE - 1], 0); 
+    OSTaskCreate(TaskKey, (void *)0, &TaskKeyStk[TASK_KEY_STK_SIZE - 1], 1); 
 
     OSStart();                  /* µC/OS-II 启动 */ 
    
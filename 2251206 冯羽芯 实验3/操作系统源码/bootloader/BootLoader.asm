@@ -41,12 +41,12 @@ Disassembly of section .text:
 30000080:	00000000 	nop
 30000084:	24010001 	li	at,1
 30000088:	3c023000 	lui	v0,0x3000
-3000008c:	24420150 	addiu	v0,v0,336
+3000008c:	2442020c 	addiu	v0,v0,524
 30000090:	3c033000 	lui	v1,0x3000
-30000094:	24630169 	addiu	v1,v1,361
+30000094:	24630225 	addiu	v1,v1,549
 30000098:	80650000 	lb	a1,0(v1)
 3000009c:	80440000 	lb	a0,0(v0)
-300000a0:	0c000049 	jal	30000124 <_print>
+300000a0:	0c000078 	jal	300001e0 <_print>
 300000a4:	20420001 	addi	v0,v0,1
 300000a8:	14a0fffc 	bnez	a1,3000009c <_waiting_sdram_init_done+0x34>
 300000ac:	00a12823 	subu	a1,a1,at
@@ -55,73 +55,134 @@ Disassembly of section .text:
 300000b8:	34210300 	ori	at,at,0x300
 300000bc:	8c210000 	lw	at,0(at)
 300000c0:	00000000 	nop
-300000c4:	3c020000 	lui	v0,0x0
+300000c4:	3c025000 	lui	v0,0x5000
 300000c8:	3c033000 	lui	v1,0x3000
 300000cc:	34630304 	ori	v1,v1,0x304
-300000d0:	8c640000 	lw	a0,0(v1)
-300000d4:	00000000 	nop
-300000d8:	ac440000 	sw	a0,0(v0)
-300000dc:	20420004 	addi	v0,v0,4
-300000e0:	20630004 	addi	v1,v1,4
-300000e4:	00000000 	nop
-300000e8:	0421fff9 	bgez	at,300000d0 <_waiting_sdram_init_done+0x68>
-300000ec:	00250823 	subu	at,at,a1
-300000f0:	24010001 	li	at,1
-300000f4:	3c023000 	lui	v0,0x3000
-300000f8:	2442016a 	addiu	v0,v0,362
-300000fc:	3c033000 	lui	v1,0x3000
-30000100:	24630185 	addiu	v1,v1,389
-30000104:	80650000 	lb	a1,0(v1)
-30000108:	80440000 	lb	a0,0(v0)
-3000010c:	0c000049 	jal	30000124 <_print>
-30000110:	20420001 	addi	v0,v0,1
-30000114:	14a0fffc 	bnez	a1,30000108 <_waiting_sdram_init_done+0xa0>
-30000118:	00a12822 	sub	a1,a1,at
-3000011c:	00000008 	jr	zero
-30000120:	00000000 	nop
-
-30000124 <_print>:
-30000124:	3c061000 	lui	a2,0x1000
-30000128:	34c60000 	ori	a2,a2,0x0
-3000012c:	a0c40000 	sb	a0,0(a2)
-
-30000130 <_waiting_transmit_done>:
-30000130:	3c061000 	lui	a2,0x1000
-30000134:	34c60005 	ori	a2,a2,0x5
-30000138:	80c70000 	lb	a3,0(a2)
-3000013c:	30e70020 	andi	a3,a3,0x20
-30000140:	10e0fffb 	beqz	a3,30000130 <_waiting_transmit_done>
-30000144:	00000000 	nop
-30000148:	03e00008 	jr	ra
-3000014c:	00000000 	nop
+300000d0:	ac430004 	sw	v1,4(v0)
+300000d4:	ac400008 	sw	zero,8(v0)
+300000d8:	00010882 	srl	at,at,0x2
+300000dc:	20210001 	addi	at,at,1
+300000e0:	ac41000c 	sw	at,12(v0)
+300000e4:	34030021 	li	v1,0x21
+300000e8:	ac430000 	sw	v1,0(v0)
+300000ec:	8c440000 	lw	a0,0(v0)
+300000f0:	00000000 	nop
+300000f4:	30840001 	andi	a0,a0,0x1
+300000f8:	1480fffc 	bnez	a0,300000ec <_waiting_sdram_init_done+0x84>
+300000fc:	00000000 	nop
+30000100:	3c013000 	lui	at,0x3000
+30000104:	8c2402f8 	lw	a0,760(at)
+30000108:	3c034352 	lui	v1,0x4352
+3000010c:	34634332 	ori	v1,v1,0x4332
+30000110:	14830026 	bne	a0,v1,300001ac <_crc_check_done>
+30000114:	00000000 	nop
+30000118:	8c250300 	lw	a1,768(at)
+3000011c:	00000000 	nop
+30000120:	20a50003 	addi	a1,a1,3
+30000124:	00052882 	srl	a1,a1,0x2
+30000128:	0000000f 	sync
+3000012c:	3c06a000 	lui	a2,0xa000
+30000130:	34030002 	li	v1,0x2
+30000134:	acc30000 	sw	v1,0(a2)
+30000138:	ac400004 	sw	zero,4(v0)
+3000013c:	34c30010 	ori	v1,a2,0x10
+30000140:	ac430008 	sw	v1,8(v0)
+30000144:	ac45000c 	sw	a1,12(v0)
+30000148:	34030021 	li	v1,0x21
+3000014c:	ac430000 	sw	v1,0(v0)
+30000150:	8c440000 	lw	a0,0(v0)
+30000154:	00000000 	nop
+30000158:	30840001 	andi	a0,a0,0x1
+3000015c:	1480fffc 	bnez	a0,30000150 <_waiting_sdram_init_done+0xe8>
+30000160:	00000000 	nop
+30000164:	8cc4000c 	lw	a0,12(a2)
+30000168:	8c2302fc 	lw	v1,764(at)
+3000016c:	00000000 	nop
+30000170:	1083000e 	beq	a0,v1,300001ac <_crc_check_done>
+30000174:	00000000 	nop
+30000178:	24010001 	li	at,1
+3000017c:	3c023000 	lui	v0,0x3000
+30000180:	24420242 	addiu	v0,v0,578
+30000184:	3c033000 	lui	v1,0x3000
+30000188:	24630258 	addiu	v1,v1,600
+3000018c:	80650000 	lb	a1,0(v1)
+30000190:	80440000 	lb	a0,0(v0)
+30000194:	0c000078 	jal	300001e0 <_print>
+30000198:	20420001 	addi	v0,v0,1
+3000019c:	14a0fffc 	bnez	a1,30000190 <_waiting_sdram_init_done+0x128>
+300001a0:	00a12823 	subu	a1,a1,at
+300001a4:	1000ffff 	b	300001a4 <_waiting_sdram_init_done+0x13c>
+300001a8:	00000000 	nop
+
+300001ac <_crc_check_done>:
+300001ac:	24010001 	li	at,1
+300001b0:	3c023000 	lui	v0,0x3000
+300001b4:	24420226 	addiu	v0,v0,550
+300001b8:	3c033000 	lui	v1,0x3000
+300001bc:	24630241 	addiu	v1,v1,577
+300001c0:	80650000 	lb	a1,0(v1)
+300001c4:	80440000 	lb	a0,0(v0)
+300001c8:	0c000078 	jal	300001e0 <_print>
+300001cc:	20420001 	addi	v0,v0,1
+300001d0:	14a0fffc 	bnez	a1,300001c4 <_crc_check_done+0x18>
+300001d4:	00a12822 	sub	a1,a1,at
+300001d8:	00000008 	jr	zero
+300001dc:	00000000 	nop
+
+300001e0 <_print>:
+300001e0:	3c061000 	lui	a2,0x1000
+300001e4:	34c60000 	ori	a2,a2,0x0
+300001e8:	a0c40000 	sb	a0,0(a2)
+
+300001ec <_waiting_transmit_done>:
+300001ec:	3c061000 	lui	a2,0x1000
+300001f0:	34c60005 	ori	a2,a2,0x5
+300001f4:	80c70000 	lb	a3,0(a2)
+300001f8:	30e70020 	andi	a3,a3,0x20
+300001fc:	10e0fffb 	beqz	a3,300001ec <_waiting_transmit_done>
+30000200:	00000000 	nop
+30000204:	03e00008 	jr	ra
+30000208:	00000000 	nop
 Disassembly of section .data:
 
-30000150 <_BootBeginInfoStr>:
-30000150:	4c6f6164 	0x4c6f6164
-30000154:	696e6720 	0x696e6720
-30000158:	4f532069 	c3	0x1532069
-3000015c:	6e746f20 	0x6e746f20
-30000160:	53445241 	beql	k0,a0,30014a68 <_ram_end+0x148d8>
-30000164:	4d2e2e2e 	0x4d2e2e2e
-30000168:	0a1a4c6f 	j	386931bc <_ram_end+0x869302c>
-
-30000169 <_BootBeginInfoStrLen>:
-30000169:	1a4c 6f61 	jal	3649bd84 <_ram_end+0x649bbf4>
-
-3000016a <_BootEndInfoStr>:
-3000016a:	4c6f6164 	0x4c6f6164
-3000016e:	204f5320 	addi	t7,v0,21280
-30000172:	696e746f 	0x696e746f
-30000176:	20534452 	addi	s3,v0,17490
-3000017a:	414d2044 	0x414d2044
-3000017e:	4f4e4521 	c3	0x14e4521
-30000182:	21210a1c 	addi	at,t1,2588
-
-30000185 <_BootEndInfoStrLen>:
-30000185:	Address 0x0000000030000185 is out of bounds.
+3000020c <_BootBeginInfoStr>:
+3000020c:	4c6f6164 	0x4c6f6164
+30000210:	696e6720 	0x696e6720
+30000214:	4f532069 	c3	0x1532069
+30000218:	6e746f20 	0x6e746f20
+3000021c:	53445241 	beql	k0,a0,30014b24 <_ram_end+0x148c4>
+30000220:	4d2e2e2e 	0x4d2e2e2e
+30000224:	0a1a4c6f 	j	386931bc <_ram_end+0x8692f5c>
+
+30000225 <_BootBeginInfoStrLen>:
+30000225:	1a4c 6f61 	jal	3649bd84 <_ram_end+0x649bb24>
+
+30000226 <_BootEndInfoStr>:
+30000226:	4c6f6164 	0x4c6f6164
+3000022a:	204f5320 	addi	t7,v0,21280
+3000022e:	696e746f 	0x696e746f
+30000232:	20534452 	addi	s3,v0,17490
+30000236:	414d2044 	0x414d2044
+3000023a:	4f4e4521 	c3	0x14e4521
+3000023e:	21210a1c 	addi	at,t1,2588
+
+30000241 <_BootEndInfoStrLen>:
+30000241:	1c4f 5320 	jalx	37894c80 <_ram_end+0x7894a20>
+
+30000242 <_BootCrcErrStr>:
+30000242:	4f532069 	c3	0x1532069
+30000246:	6d616765 	0x6d616765
+3000024a:	20435243 	addi	v1,v0,21059
+3000024e:	20657272 	addi	a1,v1,29298
+30000252:	6f722121 	0x6f722121
+30000256:	Address 0x0000000030000256 is out of bounds.
+
+
+30000258 <_BootCrcErrStrLen>:
+30000258:	Address 0x0000000030000258 is out of bounds.
 
 Disassembly of section .reginfo:
 
-00000000 <_ram_end-0x30000190>:
+00000000 <_ram_end-0x30000260>:
    0:	900000fe 	lbu	zero,254(zero)
 	...
@@ -0,0 +1,121 @@
+/****************************************************************
+***********              第一段：一些变量定义              **********
+*****************************************************************/
+#include "includes.h"
+
+/* 调度延迟测试：低优先级的 TaskBench 记下时间戳后释放信号量，等待它的高优先级任务被唤醒后
+   再读时间戳，差值包括 OSSemPost、OS_EventTaskRdy、OS_Sched（OS_SchedNew）和任务切换 */
+#define BENCH_STK_SIZE 128
+static OS_STK    TaskBenchStk[BENCH_STK_SIZE] OS_DTCM_BSS;
+static OS_EVENT *bench_sem;
+static volatile INT32U bench_t0;    /* TaskBench 释放信号量之前的时间戳 */
+
+static char bench_buf[12];
+
+/****************************************************************
+***********       第二段：调度延迟、中断开销测试的函数定义      **********
+*****************************************************************/
+
+static void bench_print_num(INT32U num)   /* 按十进制输出一个无符号数 */
+{
+    INT32S k = sizeof(bench_buf) - 1;
+
+    bench_buf[k] = '\0';
+    do
+    {
+        bench_buf[--k] = (num % 10) + '0';
+        num /= 10;
+    } while(num != 0 && k > 0);
+
+    uart_print_str(&bench_buf[k]);
+}
+
+static void TaskBench(void *pdata)
+{
+    pdata = pdata;
+
+    for(;;)
+    {
+        bench_t0 = REG32(TIMER_BASE + TIMER_TS_LO_REG);
+        OSSemPost(bench_sem);       /* 调用者优先级更高，马上切换过去 */
+    }
+}
+
+/* 测量 BENCH_LOOPS 次唤醒的调度延迟，输出最小、平均、最大值（时钟周期数）。由优先级高于
+   BENCH_PRIO 的任务调用，比它优先级低的任务都应该处于等待状态，时钟中断可能落在测量区间中，
+   体现在最大值上。用不同的 OS_CPU_RDY_METHOD（os_cpu.h）编译，比较几种就绪表的实现 */
+void sched_bench(void)
+{
+    INT32U i, t1, dt;
+    INT32U min = 0xffffffff, max = 0, total = 0;
+    INT8U  err;
+
+    bench_sem = OSSemCreate(0);
+    OSTaskCreate(TaskBench, (void *)0, &TaskBenchStk[BENCH_STK_SIZE - 1], BENCH_PRIO);
+
+    for(i = 0; i < BENCH_LOOPS; i++)
+    {
+        OSSemPend(bench_sem, 0, &err);      /* 切换到 TaskBench，由它唤醒 */
+        t1 = REG32(TIMER_BASE + TIMER_TS_LO_REG);
+        dt = t1 - bench_t0;
+        total += dt;
+        if(dt < min) min = dt;
+        if(dt > max) max = dt;
+    }
+
+    OSTaskDel(BENCH_PRIO);
+    OSSemDel(bench_sem, OS_DEL_ALWAYS, &err);
+
+    uart_print_str("sched bench, OS_CPU_RDY_METHOD ");
+    bench_print_num(OS_CPU_RDY_METHOD);
+    uart_print_str(", cycles min ");
+    bench_print_num(min);
+    uart_print_str("  avg ");
+    bench_print_num(total / BENCH_LOOPS);
+    uart_print_str("  max ");
+    bench_print_num(max);
+    uart_print_str("\n");
+}
+
+/* 中断开销测试：最高优先级的任务不停地读时间戳，两次读之间的间隔比正常循环一次的时间（最小间隔）
+   多出 ISR_BENCH_GAP 以上就是被中断打断了，多出的部分就是一次中断从进入到返回的周期数。调用者的
+   优先级最高，时钟节拍唤醒别的任务也不会切换，测到的是不切换任务的中断路径。UART、按键等其他中断
+   也会计入，测量期间不要操作 */
+void isr_bench(void)
+{
+    INT32U prev, now, dt;
+    INT32U base = 0xffffffff;
+    INT32U n = 0, min = 0xffffffff, max = 0, total = 0;
+
+    prev = REG32(TIMER_BASE + TIMER_TS_LO_REG);
+    for(;;)
+    {
+        now  = REG32(TIMER_BASE + TIMER_TS_LO_REG);
+        dt   = now - prev;
+        prev = now;
+
+        if(dt < base)
+        {
+            base = dt;
+        }
+        else if(dt > base + ISR_BENCH_GAP)
+        {
+            dt -= base;
+            total += dt;
+            if(dt < min) min = dt;
+            if(dt > max) max = dt;
+            if(++n == ISR_BENCH_TICKS)
+                break;
+        }
+    }
+
+    uart_print_str("isr bench, interrupts ");
+    bench_print_num(n);
+    uart_print_str(", cycles min ");
+    bench_print_num(min);
+    uart_print_str("  avg ");
+    bench_print_num(total / n);
+    uart_print_str("  max ");
+    bench_print_num(max);
+    uart_print_str("\n");
+}
@@ -0,0 +1,86 @@
+/****************************************************************
+***********              第一段：一些变量定义              **********
+*****************************************************************/
+#include "includes.h"
+
+/* CRC 计算单元只有一个移位寄存器，同一时间只能有一个任务使用 */
+static OS_EVENT *crc_sem;
+
+/****************************************************************
+***********        第二段：与 CRC 计算单元相关的函数定义      **********
+*****************************************************************/
+
+void crc_init(void)              /* CRC 计算单元初始化函数，需要在 OSInit、dma_init 之后调用 */
+{
+    crc_sem = OSSemCreate(1);
+    REG32(CRC_BASE + CRC_INIT_REG) = 0xffffffff;
+}
+
+/* 按 ctrl 选择的算法计算 buf 开始的 len 个字节，返回 RESULT 寄存器。开头、结尾不满一个字的
+   字节由 CPU 按字节写入数据窗口；中间的字不少于 CRC_DMA_MIN 个字节时由 DMA 按存储器到存储器
+   方式送入（数据窗口很大，目的地址递增也不会越界），否则由 CPU 按字写入。
+   DMA 借用 dma_memcpy 的通道，用 dma_memcpy_lock 与 dma_memcpy 互斥。
+   中断服务程序打断的任务可能正在计算，DMA 也可能还在往数据窗口送数据，
+   所以不允许在中断服务程序中调用，直接返回 0 */
+static INT32U crc_calc(INT32U ctrl, const void *buf, INT32U len)
+{
+    const INT8U *p = (const INT8U *)buf;
+    INT32U words;
+    INT32U result;
+    INT8U  lock = (OSRunning == OS_TRUE);
+    INT8U  err;
+
+    if(OSIntNesting > 0)
+        return 0;
+
+    if(lock)
+        OSSemPend(crc_sem, 0, &err);
+
+    REG32(CRC_BASE + CRC_CTRL_REG) = ctrl | CRC_CTRL_INIT;
+
+    while(len > 0 && ((INT32U)p & 0x3) != 0)
+    {
+        REG8(CRC_BASE + CRC_DATA_REG) = *p++;
+        len--;
+    }
+
+    words = len >> 2;
+    if((words << 2) >= CRC_DMA_MIN)
+    {
+        dma_memcpy_lock();
+        dma_start(DMA_CH_MEMCPY, (INT32U)p, CRC_BASE + CRC_DATA_REG, words, DMA_MODE_M2M | DMA_SIZE_WORD);
+        dma_wait(DMA_CH_MEMCPY);
+        dma_memcpy_unlock();
+        p += words << 2;
+    }
+    else
+    {
+        for(; words > 0; words--)
+        {
+            REG32(CRC_BASE + CRC_DATA_REG) = *(const INT32U *)p;
+            p += 4;
+        }
+    }
+
+    for(len &= 0x3; len > 0; len--)
+    {
+        REG8(CRC_BASE + CRC_DATA_REG) = *p++;
+    }
+
+    result = REG32(CRC_BASE + CRC_RESULT_REG);
+
+    if(lock)
+        OSSemPost(crc_sem);
+
+    return result;
+}
+
+INT32U crc32(const void *buf, INT32U len)   /* CRC-32，结果与 zlib 的 crc32(0, buf, len) 相同 */
+{
+    return crc_calc(0, buf, len);
+}
+
+INT16U crc16(const void *buf, INT32U len)   /* CRC-16/MODBUS，初值 0xFFFF */
+{
+    return (INT16U)crc_calc(CRC_CTRL_CRC16, buf, len);
+}
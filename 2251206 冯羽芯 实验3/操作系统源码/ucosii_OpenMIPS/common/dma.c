@@ -0,0 +1,131 @@
+/****************************************************************
+***********              第一段：一些变量定义              **********
+*****************************************************************/
+#include "includes.h"
+
+/* 每个通道一个信号量，任务等待传输完成时挂起在上面，由完成中断释放 */
+static OS_EVENT *dma_sem[DMA_CH_NUM];
+
+/* 本次传输是否使用完成中断。OS 启动之前、或者在中断服务程序中调用时只能查询 */
+static INT8U dma_use_irq[DMA_CH_NUM];
+
+/* dma_memcpy 的通道也借给 CRC 计算单元送数据，使用者之间用这个信号量互斥 */
+static OS_EVENT *dma_memcpy_sem;
+
+/****************************************************************
+***********          第二段：与 DMA 控制器相关的函数定义      **********
+*****************************************************************/
+
+void dma_init(void)              /* DMA 控制器初始化函数，需要在 OSInit 之后调用 */
+{
+    INT8U ch;
+
+    for(ch = 0; ch < DMA_CH_NUM; ch++)
+    {
+        DMA_CH_REG(ch, DMA_CTRL_REG) = 0x00;      /* 停止通道 */
+        dma_sem[ch]     = OSSemCreate(0);
+        dma_use_irq[ch] = 0;
+    }
+    dma_memcpy_sem = OSSemCreate(1);
+    REG32(DMA_BASE + DMA_INT_STATUS_REG) = (1 << DMA_CH_NUM) - 1; /* 清除完成标志 */
+    pic_attach(DMA_PIC_SRC, DMA_PIC_PRIO, 0, dma_isr);
+}
+
+/* 启动通道 ch，count 是传输的单位个数，ctrl 给出传输模式和单位大小，不需要包含 EN、IE。
+   同一个通道同一时间只能有一个使用者 */
+void dma_start(INT8U ch, INT32U src, INT32U dst, INT32U count, INT32U ctrl)
+{
+    dma_use_irq[ch] = (OSRunning == OS_TRUE) && (OSIntNesting == 0);
+
+    ddr_fence();                         /* 之前对缓冲区的写操作先全部写入 SDRAM */
+
+    DMA_CH_REG(ch, DMA_SRC_REG)   = src;
+    DMA_CH_REG(ch, DMA_DST_REG)   = dst;
+    DMA_CH_REG(ch, DMA_COUNT_REG) = count;
+    DMA_CH_REG(ch, DMA_CTRL_REG)  = ctrl | DMA_CTRL_EN | (dma_use_irq[ch] ? DMA_CTRL_IE : 0);
+}
+
+void dma_wait(INT8U ch)          /* 等待通道 ch 传输完成 */
+{
+    INT8U err;
+
+    if(dma_use_irq[ch])
+    {
+        OSSemPend(dma_sem[ch], 0, &err);   /* 挂起当前任务，CPU 可以去执行其它任务 */
+    }
+    else
+    {
+        while((DMA_CH_REG(ch, DMA_CTRL_REG) & DMA_CTRL_EN) != 0)
+            ;
+        REG32(DMA_BASE + DMA_INT_STATUS_REG) = 1 << ch;
+    }
+}
+
+/* 占用、归还 DMA_CH_MEMCPY 通道。OS 启动之前只有一个使用者，不需要互斥；
+   中断服务程序中不能挂起，不能使用这个通道 */
+void dma_memcpy_lock(void)
+{
+    INT8U err;
+
+    if(OSRunning == OS_TRUE)
+        OSSemPend(dma_memcpy_sem, 0, &err);
+}
+
+void dma_memcpy_unlock(void)
+{
+    if(OSRunning == OS_TRUE)
+        OSSemPost(dma_memcpy_sem);
+}
+
+/* 存储器之间的复制，地址和长度都按 4 字节对齐时按字传输，否则按半字或字节传输。
+   不能在中断服务程序中调用 */
+void dma_memcpy(void *dst, const void *src, INT32U len)
+{
+    INT32U align = (INT32U)dst | (INT32U)src | len;
+
+    if(len == 0)
+        return;
+
+    dma_memcpy_lock();
+
+    if((align & 0x3) == 0)
+        dma_start(DMA_CH_MEMCPY, (INT32U)src, (INT32U)dst, len >> 2, DMA_MODE_M2M | DMA_SIZE_WORD);
+    else if((align & 0x1) == 0)
+        dma_start(DMA_CH_MEMCPY, (INT32U)src, (INT32U)dst, len >> 1, DMA_MODE_M2M | DMA_SIZE_HALF);
+    else
+        dma_start(DMA_CH_MEMCPY, (INT32U)src, (INT32U)dst, len, DMA_MODE_M2M | DMA_SIZE_BYTE);
+
+    dma_wait(DMA_CH_MEMCPY);
+
+    dma_memcpy_unlock();
+}
+
+/* 通过 UART 输出 len 个字节。DMA 按 UART 的发送请求线传输，发送 FIFO 未满就写入，
+   不用查询 Line Status 寄存器，也不用等 FIFO 全空 */
+void dma_uart_write(const char *buf, INT32U len)
+{
+    if(len == 0)
+        return;
+
+    dma_start(DMA_CH_UART, (INT32U)buf, UART_BASE + UART_TH_REG, len,
+              DMA_MODE_M2P | DMA_SIZE_BYTE | DMA_CTRL_HREQ | DMA_REQ_UART_TX);
+    dma_wait(DMA_CH_UART);
+}
+
+void dma_isr(void)               /* DMA 完成中断处理函数，由 pic_dispatch 调用 */
+{
+    INT32U status;
+    INT8U  ch;
+
+    /* 读出完成标志并写 1 清零，撤销中断请求 */
+    status = REG32(DMA_BASE + DMA_INT_STATUS_REG);
+    REG32(DMA_BASE + DMA_INT_STATUS_REG) = status;
+
+    for(ch = 0; ch < DMA_CH_NUM; ch++)
+    {
+        if((status & (1 << ch)) != 0 && dma_use_irq[ch])
+        {
+            OSSemPost(dma_sem[ch]);        /* 唤醒等待该通道的任务 */
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/****************************************************************
+***********              第一段：一些变量定义              **********
+*****************************************************************/
+#include "includes.h"
+
+/* 从设备、主设备的名字，与地址的高 4 位、性能监视器的主设备编号对应 */
+static char *perf_slave_name[PERF_SLAVE_NUM] = {
+    "sdram", "uart ", "gpio ", "flash", "brom ", "dma  ", "perf ", "seg7 ",
+    "pic  ", "timer", "crc  ", "rdy  ", "s12  ", "s13  ", "s14  ", "s15  "
+};
+static char *perf_master_name[PERF_MASTER_NUM] = { "data", "inst", "dma " };
+
+/* 直方图每个区间的上界 */
+static char *perf_bucket_name[PERF_BUCKET_NUM] = {
+    "1", "2", "4", "8", "16", "32", "64", ">64"
+};
+
+/* 输出缓冲区放在 SDRAM 中，uart_print_str 再复制给 DMA */
+static char perf_buf[12];
+
+/****************************************************************
+***********       第二段：与总线性能监视器相关的函数定义     **********
+*****************************************************************/
+
+static void perf_print_num(INT32U num)    /* 按十进制输出一个无符号数 */
+{
+    INT32S k = sizeof(perf_buf) - 1;
+
+    perf_buf[k] = '\0';
+    do
+    {
+        perf_buf[--k] = (num % 10) + '0';
+        num /= 10;
+    } while(num != 0 && k > 0);
+
+    uart_print_str(&perf_buf[k]);
+}
+
+void perf_start(void)            /* 清零所有计数器并开始统计 */
+{
+    REG32(PERF_BASE + PERF_CTRL_REG) = PERF_CTRL_CLR;
+    REG32(PERF_BASE + PERF_CTRL_REG) = PERF_CTRL_EN;
+}
+
+void perf_stop(void)             /* 停止统计，之后读出的结果不再变化 */
+{
+    REG32(PERF_BASE + PERF_CTRL_REG) = 0;
+}
+
+/* 输出每个主设备访问每个从设备的次数、平均延迟、最大延迟、放弃次数，以及每个从设备
+   的延迟直方图。只输出访问过的从设备。输出本身也要访问 UART、DMA，所以先停止统计 */
+void perf_dump(void)
+{
+    INT32U m, s, b;
+    INT32U count, total, hist;
+
+    perf_stop();
+
+    uart_print_str("bus perf, cycles ");
+    perf_print_num(REG32(PERF_BASE + PERF_CYCLES_REG));
+    uart_print_str("\n");
+
+    for(m = 0; m < PERF_MASTER_NUM; m++)
+    {
+        for(s = 0; s < PERF_SLAVE_NUM; s++)
+        {
+            count = PERF_COUNT(m, s);
+            if(count == 0 && PERF_ABORT(m, s) == 0)
+                continue;
+            total = PERF_TOTAL(m, s);
+
+            uart_print_str(perf_master_name[m]);
+            uart_print_str(" -> ");
+            uart_print_str(perf_slave_name[s]);
+            uart_print_str("  count ");
+            perf_print_num(count);
+            uart_print_str("  avg ");
+            perf_print_num(count == 0 ? 0 : total / count);
+            uart_print_str("  max ");
+            perf_print_num(PERF_MAX(m, s));
+            uart_print_str("  abort ");
+            perf_print_num(PERF_ABORT(m, s));
+            uart_print_str("\n");
+        }
+    }
+
+    for(s = 0; s < PERF_SLAVE_NUM; s++)
+    {
+        total = 0;
+        for(b = 0; b < PERF_BUCKET_NUM; b++)
+            total += PERF_HIST(s, b);
+        if(total == 0)
+            continue;
+
+        uart_print_str(perf_slave_name[s]);
+        uart_print_str(" latency");
+        for(b = 0; b < PERF_BUCKET_NUM; b++)
+        {
+            hist = PERF_HIST(s, b);
+            uart_print_str("  ");
+            uart_print_str(perf_bucket_name[b]);
+            uart_print_str(":");
+            perf_print_num(hist);
+        }
+        uart_print_str("\n");
+    }
+}
@@ -0,0 +1,110 @@
+/****************************************************************
+***********              第一段：一些变量定义              **********
+*****************************************************************/
+#include "includes.h"
+
+/* 每个中断源的处理函数，为 0 表示没有挂接 */
+static void (*pic_isr_tbl[PIC_SRC_NUM])(void);
+
+/****************************************************************
+***********        第二段：与中断控制器相关的函数定义        **********
+*****************************************************************/
+
+void pic_init(void)              /* 中断控制器初始化函数，需要在各个外设初始化之前调用 */
+{
+    INT8U src;
+
+    REG32(PIC_BASE + PIC_MASK_REG)   = 0;
+    REG32(PIC_BASE + PIC_EDGE_REG)   = 0;
+    REG32(PIC_BASE + PIC_PEND_REG)   = 0xffffffff;
+    REG32(PIC_BASE + PIC_THRESH_REG) = 0;
+    for(src = 0; src < PIC_SRC_NUM; src++)
+    {
+        pic_isr_tbl[src] = (void (*)(void))0;
+    }
+}
+
+/* 挂接中断源 src 的处理函数，设置优先级（1~15，0 表示不产生中断）和触发方式，然后允许该中断源。
+   处理函数在打开中断的情况下执行，只有优先级更高的中断可以嵌套进来 */
+void pic_attach(INT8U src, INT8U prio, INT8U edge, void (*isr)(void))
+{
+    INT32U prio_reg = PIC_BASE + PIC_PRIO_REG + ((src >> 3) << 2);
+    INT32U shift    = (src & 0x7) << 2;
+#if OS_CRITICAL_METHOD == 3
+    OS_CPU_SR cpu_sr;
+#endif
+
+    /* 读-改-写共用的寄存器，关中断防止被打断 */
+    OS_ENTER_CRITICAL();
+    pic_isr_tbl[src] = isr;
+    REG32(prio_reg) = (REG32(prio_reg) & ~(0xf << shift)) | ((prio & 0xf) << shift);
+    if(edge)
+        REG32(PIC_BASE + PIC_EDGE_REG) |= 1 << src;
+    else
+        REG32(PIC_BASE + PIC_EDGE_REG) &= ~(1 << src);
+    REG32(PIC_BASE + PIC_PEND_REG) = 1 << src;     /* 清除之前锁存的边沿 */
+    REG32(PIC_BASE + PIC_MASK_REG) |= 1 << src;
+    OS_EXIT_CRITICAL();
+}
+
+void pic_mask(INT8U src)         /* 屏蔽中断源 src */
+{
+#if OS_CRITICAL_METHOD == 3
+    OS_CPU_SR cpu_sr;
+#endif
+
+    OS_ENTER_CRITICAL();
+    REG32(PIC_BASE + PIC_MASK_REG) &= ~(1 << src);
+    OS_EXIT_CRITICAL();
+}
+
+void pic_unmask(INT8U src)       /* 允许中断源 src */
+{
+#if OS_CRITICAL_METHOD == 3
+    OS_CPU_SR cpu_sr;
+#endif
+
+    OS_ENTER_CRITICAL();
+    REG32(PIC_BASE + PIC_MASK_REG) |= 1 << src;
+    OS_EXIT_CRITICAL();
+}
+
+/* 由 BSP_Interrupt_Handler 调用，此时 Status 的 EXL 为 1。每次读 VECTOR 得到优先级最高的
+   待处理中断，把 THRESH 提高到它的优先级，清除 EXL 打开中断后调用处理函数，这期间更高优先级
+   的中断可以嵌套进来。处理函数返回后关中断、恢复 THRESH，再处理下一个，直到没有高于进入时
+   THRESH 的待处理中断。EPC、Status 已经由 InterruptHandler 保存在堆栈中。
+   已经嵌套了 OS_CPU_INT_NEST_MAX 层时不再打开中断，中断堆栈的大小按这个层数计算 */
+void pic_dispatch(void)
+{
+    INT32U vec;
+    INT32U src;
+    INT32U thresh;
+    INT32U sr;
+
+    thresh = REG32(PIC_BASE + PIC_THRESH_REG);
+    asm volatile("mfc0   %0,$12" : "=r"(sr));
+
+    for(;;)
+    {
+        vec = REG32(PIC_BASE + PIC_VECTOR_REG);
+        if((vec & PIC_VEC_NONE) != 0)
+            break;
+
+        src = PIC_VEC_SRC(vec);
+        if(pic_isr_tbl[src] == 0)
+        {
+            /* 没有挂接处理函数的中断源被允许了，屏蔽掉，避免一直请求中断 */
+            REG32(PIC_BASE + PIC_MASK_REG) &= ~(1 << src);
+            continue;
+        }
+
+        REG32(PIC_BASE + PIC_THRESH_REG) = PIC_VEC_PRIO(vec);
+
+        if(OSIntNesting < OS_CPU_INT_NEST_MAX)
+            asm volatile("mtc0   %0,$12" : : "r"((sr & ~0x2) | 0x1));   /* EXL 清零、IE 置 1 */
+        pic_isr_tbl[src]();
+        asm volatile("mtc0   %0,$12" : : "r"(sr & ~0x3));           /* 关中断 */
+
+        REG32(PIC_BASE + PIC_THRESH_REG) = thresh;
+    }
+}
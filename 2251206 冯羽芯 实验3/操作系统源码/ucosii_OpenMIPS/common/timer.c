@@ -0,0 +1,57 @@
+/****************************************************************
+***********              第一段：一些变量定义              **********
+*****************************************************************/
+#include "includes.h"
+
+/****************************************************************
+***********          第二段：与定时器相关的函数定义         **********
+*****************************************************************/
+
+void timer_init(void)            /* 定时器初始化函数，停止所有通道并清除到期标志 */
+{
+    INT8U ch;
+
+    for(ch = 0; ch < TIMER_CH_NUM; ch++)
+    {
+        TIMER_CH_REG(ch, TIMER_CTRL_REG) = 0;
+    }
+    REG32(TIMER_BASE + TIMER_STATUS_REG) = (1 << TIMER_CH_NUM) - 1;
+}
+
+/* 启动通道 ch，每 period 个时钟周期到期一次。ctrl 可以包含 TIMER_CTRL_ONESHOT、TIMER_CTRL_IE，
+   需要中断时先用 pic_attach 挂接处理函数，处理函数中调用 timer_ack 清除到期标志 */
+void timer_start(INT8U ch, CPU_INT64U period, INT32U ctrl)
+{
+    TIMER_CH_REG(ch, TIMER_CTRL_REG)    = 0;
+    REG32(TIMER_BASE + TIMER_STATUS_REG) = 1 << ch;
+    TIMER_CH_REG(ch, TIMER_LOAD_LO_REG) = (INT32U)period;
+    TIMER_CH_REG(ch, TIMER_LOAD_HI_REG) = (INT32U)(period >> 32);
+    TIMER_CH_REG(ch, TIMER_CTRL_REG)    = ctrl | TIMER_CTRL_EN;
+}
+
+void timer_stop(INT8U ch)        /* 停止通道 ch */
+{
+    TIMER_CH_REG(ch, TIMER_CTRL_REG) = 0;
+}
+
+void timer_ack(INT8U ch)         /* 清除通道 ch 的到期标志，撤销中断请求 */
+{
+    REG32(TIMER_BASE + TIMER_STATUS_REG) = 1 << ch;
+}
+
+/* 读 64 位时间戳。读低 32 位时硬件锁存高 32 位，两次读之间如果有中断处理函数也读了时间戳，
+   锁存的值会被改写，所以关中断 */
+CPU_INT64U timer_ts(void)
+{
+    INT32U lo, hi;
+#if OS_CRITICAL_METHOD == 3
+    OS_CPU_SR cpu_sr;
+#endif
+
+    OS_ENTER_CRITICAL();
+    lo = REG32(TIMER_BASE + TIMER_TS_LO_REG);
+    hi = REG32(TIMER_BASE + TIMER_TS_HI_REG);
+    OS_EXIT_CRITICAL();
+
+    return ((CPU_INT64U)hi << 32) | lo;
+}
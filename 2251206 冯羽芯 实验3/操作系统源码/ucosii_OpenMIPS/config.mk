@@ -22,7 +22,7 @@ OBJCOPY   = $(CROSS_COMPILE)objcopy
 OBJDUMP   = $(CROSS_COMPILE)objdump
 RANLIB   = $(CROSS_COMPILE)ranlib
 
-CFLAGS += -I$(TOPDIR)/include -I$(TOPDIR)/ucos -I$(TOPDIR)/common -Wall -Wstrict-prototypes -Werror-implicit-function-declaration -fomit-frame-pointer -fno-strength-reduce -O2 -g -pipe -fno-builtin -nostdlib -mips32 -G 0
+CFLAGS += -I$(TOPDIR)/include -I$(TOPDIR)/ucos -I$(TOPDIR)/common -Wall -Wstrict-prototypes -Werror-implicit-function-declaration -fomit-frame-pointer -fno-strength-reduce -O2 -g -pipe -fno-builtin -nostdlib -mips32 -G 0 -ffunction-sections
 
 ASFLAGS += $(CFLAGS)
 
@@ -19,14 +19,40 @@
 #define UART_LC_REG     0x00000003    /* Line Control 寄存器的偏移地址 */ 
 #define UART_IE_REG     0x00000001    /* Interrupt Enable 寄存器的偏移地址 */ 
 #define UART_TH_REG     0x00000000    /* Transmitter Holding 寄存器的偏移地址*/ 
+#define UART_RB_REG     0x00000000    /* Receiver Buffer 寄存器的偏移地址（读） */ 
 #define UART_LS_REG     0x00000005    /* Line Status 寄存器的偏移地址 */ 
+#define UART_II_REG     0x00000002    /* Interrupt Identification 寄存器的偏移地址（读） */ 
+#define UART_FC_REG     0x00000002    /* FIFO Control 寄存器的偏移地址（写） */ 
 #define UART_DLB1_REG   0x00000000    /* 分频系数低字节的偏移地址 */ 
 #define UART_DLB2_REG   0x00000001    /* 分频系数高字节的偏移地址 */ 
  
 /* Line Status 寄存器的标志位 */ 
 #define UART_LS_TEMT 0x40 /* 第 6bit 为发送数据空标志   */ 
 #define UART_LS_THRE 0x20 /* 第 5bit 为发送 FIFO 空标志 */ 
+#define UART_LS_DR   0x01 /* 第 0bit 为接收 FIFO 中有数据标志 */ 
  
+/* Interrupt Enable 寄存器的标志位 */ 
+#define UART_IE_RDA   0x01 /* 第 0bit 为接收数据可用（及超时）中断使能 */ 
+#define UART_IE_THRE  0x02 /* 第 1bit 为发送 FIFO 空中断使能 */ 
+
+/* Interrupt Identification 寄存器的标志位 */ 
+#define UART_II_NO_INT 0x01 /* 第 0bit 为 1 表示没有待处理的中断 */ 
+#define UART_II_MASK   0x0e /* 第 3~1bit 为中断来源 */ 
+#define UART_II_THRE   0x02 /* 发送 FIFO 空 */ 
+#define UART_II_RDA    0x04 /* 接收 FIFO 中的字节数达到触发深度 */ 
+#define UART_II_TI     0x0c /* 接收超时：FIFO 中有字节，但 4 个字符时间内没有新的字节 */ 
+
+/* FIFO Control 寄存器的标志位 */ 
+#define UART_FC_CLR_RX 0x02 /* 第 1bit 写 1 清空接收 FIFO */ 
+#define UART_FC_CLR_TX 0x04 /* 第 2bit 写 1 清空发送 FIFO */ 
+#define UART_FC_TRIG_8 0x80 /* 第 7~6bit 为接收 FIFO 的触发深度，10 表示 8 个字节 */ 
+
+#define UART_FIFO_DEPTH 1024 /* 发送 FIFO 的深度，与 uart_defines.v 中的 UART_TX_FIFO_POINTER_W 一致 */ 
+
+/* UART 中断连接到中断控制器的中断源 1，接收 FIFO 溢出会丢数据，优先级最高 */ 
+#define UART_PIC_SRC    1 
+#define UART_PIC_PRIO   4 
+
 /* Line Control 寄存器的标志位 */ 
 #define UART_LC_NO_PARITY  0x00 /* 第 3bit 为 0，表示禁止奇偶校验 */ 
 #define UART_LC_ONE_STOP   0x00 /* 第 2bit 为 0，表示 1 位停止位 */ 
@@ -36,6 +62,8 @@
 extern void uart_init(void);       /* UART 控制器初始化函数 */ 
 extern void uart_putc(char);       /* UART 控制器输出字节函数 */ 
 extern void uart_print_str(char*); /* UART 控制器输出字符串函数 */
+extern INT16S uart_getc(INT16U timeout); /* 从 UART 读一个字节，超时返回 -1 */ 
+extern void uart_isr(void);        /* UART 中断处理函数 */
 
 /**************************************************************** 
 ***********         第四段：与 GPIO 模块有关的宏          ********** 
@@ -46,13 +74,270 @@ extern void uart_print_str(char*); /* UART 控制器输出字符串函数 */
 #define GPIO_OUT_REG  0x00000004   /* GPIO 模块输出寄存器的偏移地址 */ 
 #define GPIO_OE_REG   0x00000008   /* GPIO 模块输出使能寄存器的偏移地址 */ 
 #define GPIO_INTE_REG 0x0000000c   /* GPIO 模块中断使能寄存器的偏移地址 */ 
- 
+#define GPIO_PTRIG_REG 0x00000010  /* 触发边沿寄存器的偏移地址，1 为上升沿、0 为下降沿 */ 
+#define GPIO_CTRL_REG 0x00000018   /* GPIO 模块控制寄存器的偏移地址 */ 
+#define GPIO_INTS_REG 0x0000001c   /* 中断状态寄存器的偏移地址，每个输入一位，写入新值清除 */ 
+#define GPIO_OUT_SET_REG 0x00000028 /* 写 1 的位把输出寄存器的对应位置 1 */ 
+#define GPIO_OUT_CLR_REG 0x0000002c /* 写 1 的位把输出寄存器的对应位清 0 */ 
+#define GPIO_OUT_TGL_REG 0x00000030 /* 写 1 的位把输出寄存器的对应位取反 */ 
+
+/* 输出寄存器中的各个字段 */ 
+#define GPIO_OUT_LED      0xffff0000 /* 第 31~16bit 为 LED */ 
+#define GPIO_OUT_SEG      0x0000ff00 /* 第 15~8bit 为数码管段码 */ 
+#define GPIO_OUT_SEL      0x000000ff /* 第 7~0bit 为数码管位选 */ 
+
+#define GPIO_CTRL_INTE    0x01     /* 控制寄存器的第 0bit 为中断总使能 */ 
+
+/* 输入的分配：第 0bit 为 N17 按键（确认），第 4~1bit 为拨动开关（上、下、左、右）， 
+   第 16bit 为 sdram_init_done。开关和按键在硬件中已经消抖 */ 
+#define GPIO_KEY_CONFIRM  0x00000001 
+
+/* GPIO 中断连接到中断控制器的中断源 2 */ 
+#define GPIO_PIC_SRC      2 
+#define GPIO_PIC_PRIO     1 
+
 /* 一些函数声明 */ 
 extern void gpio_init(void);       /* GPIO 模块初始化函数 */ 
 extern void gpio_out(INT32U);      /* GPIO 模块输出函数 */ 
 extern INT32U gpio_in(void);       /* 读取 GPIO 模块输入的函数 */
+extern void gpio_set(INT32U mask);    /* 把输出中 mask 为 1 的位置 1 */ 
+extern void gpio_clr(INT32U mask);    /* 把输出中 mask 为 1 的位清 0 */ 
+extern void gpio_toggle(INT32U mask); /* 把输出中 mask 为 1 的位取反 */ 
+extern void gpio_write_field(INT32U mask, INT32U value); /* 只改写输出的一个字段 */ 
+extern void gpio_isr(void);        /* GPIO 中断处理函数 */ 
+
+/**************************************************************** 
+***********      第五段：与 Flash 及其 XIP 读缓存有关的宏     ********** 
+*****************************************************************/ 
+
+#define FLASH_BASE        0x30000000   /* Flash 的起始地址，经过 XIP 读缓存访问 */ 
+#define FLASH_CACHE_INV   0x3F000000   /* 写这个地址使 XIP 读缓存整体失效 */ 
+
+/* 写 Flash（或 Flash 内容被外部改写）之后，使缓存失效，保证读到新的内容 */ 
+#define flash_cache_invalidate()  (REG32(FLASH_CACHE_INV) = 0) 
+
+/**************************************************************** 
+***********           第六段：与 DMA 控制器有关的宏          ********** 
+*****************************************************************/ 
+
+#define DMA_BASE            0x50000000   /* DMA 控制器的起始地址 */ 
+#define DMA_CH_STRIDE       0x00000020   /* 每个通道占用的寄存器空间 */ 
+#define DMA_CTRL_REG        0x00000000   /* 控制寄存器的偏移地址 */ 
+#define DMA_SRC_REG         0x00000004   /* 源地址寄存器的偏移地址 */ 
+#define DMA_DST_REG         0x00000008   /* 目的地址寄存器的偏移地址 */ 
+#define DMA_COUNT_REG       0x0000000c   /* 传输次数寄存器的偏移地址 */ 
+#define DMA_STAT_ADDR_REG   0x00000010   /* 外设状态寄存器地址的偏移地址 */ 
+#define DMA_STAT_MASK_REG   0x00000014   /* 外设状态位掩码的偏移地址 */ 
+#define DMA_INT_STATUS_REG  0x00000040   /* 完成标志寄存器的偏移地址，写 1 清零 */ 
+
+/* 通道 ch 的寄存器 */ 
+#define DMA_CH_REG(ch, reg) REG32(DMA_BASE + (ch) * DMA_CH_STRIDE + (reg)) 
+
+/* 控制寄存器的标志位 */ 
+#define DMA_CTRL_EN     0x01   /* 第 0bit 为通道使能，传输完成后由硬件清零 */ 
+#define DMA_CTRL_IE     0x02   /* 第 1bit 为完成中断使能 */ 
+#define DMA_MODE_M2M    0x00   /* 存储器到存储器 */ 
+#define DMA_MODE_M2P    0x04   /* 存储器到外设，目的地址固定 */ 
+#define DMA_MODE_P2M    0x08   /* 外设到存储器，源地址固定 */ 
+#define DMA_SIZE_BYTE   0x00   /* 每次传输一个字节 */ 
+#define DMA_SIZE_HALF   0x10   /* 每次传输一个半字 */ 
+#define DMA_SIZE_WORD   0x20   /* 每次传输一个字 */ 
+#define DMA_CTRL_HREQ   0x40   /* 第 6bit 为 1 时按外设的请求线传输，不查询状态寄存器 */ 
+#define DMA_REQ_UART_TX 0x00   /* 第 7bit 选择请求线：UART 发送 FIFO 未满 */ 
+#define DMA_REQ_UART_RX 0x80   /* UART 接收 FIFO 非空 */ 
+
+#define DMA_CH_NUM      2      /* 通道数 */ 
+#define DMA_CH_MEMCPY   0      /* dma_memcpy 使用的通道 */ 
+#define DMA_CH_UART     1      /* UART 批量输出使用的通道 */ 
+
+/* SDRAM 控制器的写操作先进入写队列就给出应答，sync 指令等待写队列排空， 
+   保证之前的写操作都已写入 SDRAM */ 
+#define ddr_fence()  asm volatile("sync" : : : "memory") 
+
+/* DMA 完成中断连接到中断控制器的中断源 3 */ 
+#define DMA_PIC_SRC     3 
+#define DMA_PIC_PRIO    2 
+
+/* 一些函数声明。DMA 只能访问总线上的存储器，缓冲区不能放在 DTCM（任务堆栈）中 */ 
+extern void dma_init(void);        /* DMA 控制器初始化函数 */ 
+extern void dma_start(INT8U ch, INT32U src, INT32U dst, INT32U count, INT32U ctrl); 
+extern void dma_wait(INT8U ch);    /* 等待通道传输完成 */ 
+extern void dma_memcpy(void *dst, const void *src, INT32U len); 
+extern void dma_memcpy_lock(void);   /* 占用 DMA_CH_MEMCPY 通道，与 dma_memcpy 互斥 */ 
+extern void dma_memcpy_unlock(void); /* 归还 DMA_CH_MEMCPY 通道 */ 
+extern void dma_uart_write(const char *buf, INT32U len); 
+extern void dma_isr(void);         /* DMA 完成中断处理函数 */ 
+
+/**************************************************************** 
+***********         第七段：与总线性能监视器有关的宏        ********** 
+*****************************************************************/ 
+
+#define PERF_BASE           0x60000000   /* 总线性能监视器的起始地址 */ 
+#define PERF_CTRL_REG       0x00000000   /* 控制寄存器的偏移地址 */ 
+#define PERF_CYCLES_REG     0x00000004   /* 统计周期数寄存器的偏移地址 */ 
+#define PERF_CTRL_EN        0x01         /* 第 0bit 为 1 时统计 */ 
+#define PERF_CTRL_CLR       0x02         /* 写第 1bit 为 1 清零所有计数器 */ 
+
+#define PERF_MASTER_NUM     3            /* 0 数据总线、1 指令总线、2 DMA */ 
+#define PERF_SLAVE_NUM      16           /* 与地址的高 4 位对应，0 SDRAM ~ 11 就绪表 */ 
+#define PERF_BUCKET_NUM     8            /* 延迟直方图的区间数 */ 
+
+/* 主设备 m 访问从设备 s 的统计：次数、延迟之和、最大延迟、放弃次数 */ 
+#define PERF_COUNT(m, s)    REG32(PERF_BASE + 0x100 + (m) * 0x100 + (s) * 0x10 + 0x0) 
+#define PERF_TOTAL(m, s)    REG32(PERF_BASE + 0x100 + (m) * 0x100 + (s) * 0x10 + 0x4) 
+#define PERF_MAX(m, s)      REG32(PERF_BASE + 0x100 + (m) * 0x100 + (s) * 0x10 + 0x8) 
+#define PERF_ABORT(m, s)    REG32(PERF_BASE + 0x100 + (m) * 0x100 + (s) * 0x10 + 0xc) 
+/* 从设备 s 的延迟落在第 b 个区间（1、2、3~4、5~8、... 、65 以上）的次数 */ 
+#define PERF_HIST(s, b)     REG32(PERF_BASE + 0x400 + (s) * 0x20 + (b) * 4) 
+
+/* 一些函数声明 */ 
+extern void perf_start(void);      /* 清零并开始统计 */ 
+extern void perf_stop(void);       /* 停止统计，计数器保持不变 */ 
+extern void perf_dump(void);       /* 通过 UART 输出统计结果 */ 
+
+/**************************************************************** 
+***********           第八段：与数码管控制器有关的宏       ********** 
+*****************************************************************/ 
+
+#define SEG7_BASE           0x70000000   /* 数码管控制器的起始地址 */ 
+#define SEG7_CTRL_REG       0x00000000   /* 控制寄存器的偏移地址 */ 
+#define SEG7_HEX_REG        0x00000004   /* 十六进制显示缓冲，[3:0] 为最右边一位 */ 
+#define SEG7_RAW0_REG       0x00000008   /* 第 0~3 位的段码，低电平点亮 */ 
+#define SEG7_RAW1_REG       0x0000000C   /* 第 4~7 位的段码 */ 
+
+#define SEG7_CTRL_EN        0x00000001   /* 第 0bit 为 1 时由控制器驱动数码管，否则由 GPIO 驱动 */ 
+#define SEG7_CTRL_RAW       0x00000002   /* 第 1bit 为 1 时显示段码，为 0 时显示十六进制数 */ 
+#define SEG7_CTRL_LZB       0x00000004   /* 第 2bit 为 1 时熄灭高位的 0 */ 
+#define SEG7_CTRL_DP(d)     (0x00000100 << (d))   /* 第 d 位的小数点 */ 
+#define SEG7_CTRL_BLANK(d)  (0x00010000 << (d))   /* 熄灭第 d 位 */ 
+
+/* 直接写显示缓冲，只要一条 sw 指令 */ 
+#define seg7_show_hex(v)    (REG32(SEG7_BASE + SEG7_HEX_REG) = (INT32U)(v)) 
+
+/* 一些函数声明 */ 
+extern void seg7_init(void);       /* 数码管控制器初始化函数，十进制显示、熄灭高位的 0 */ 
+extern INT32U seg7_bcd(INT32U num); /* 把二进制数转换为 8 位 BCD 码，超过 99999999 显示 99999999 */ 
+
+/**************************************************************** 
+***********           第九段：与中断控制器有关的宏         ********** 
+*****************************************************************/ 
+
+#define PIC_BASE            0x80000000   /* 中断控制器的起始地址 */ 
+#define PIC_PEND_REG        0x00000000   /* 请求寄存器，写 1 清除边沿触发的请求 */ 
+#define PIC_MASK_REG        0x00000004   /* 屏蔽寄存器，1 表示允许 */ 
+#define PIC_EDGE_REG        0x00000008   /* 触发方式寄存器，1 表示上升沿触发 */ 
+#define PIC_VECTOR_REG      0x0000000C   /* 优先级最高的待处理中断，只读 */ 
+#define PIC_PRIO_REG        0x00000010   /* 优先级寄存器，每个中断源 4 位，共 4 个 */ 
+#define PIC_THRESH_REG      0x00000020   /* 当前优先级，只有更高优先级的中断能请求 */ 
+
+#define PIC_SRC_NUM         32 
+#define PIC_VEC_NONE        0x80000000   /* VECTOR 的第 31bit 为 1 表示没有待处理中断 */ 
+#define PIC_VEC_SRC(v)      ((v) & 0x1f)          /* 中断源编号 */ 
+#define PIC_VEC_PRIO(v)     (((v) >> 8) & 0xf)    /* 中断源的优先级 */ 
+
+/* 中断控制器的输出连接到 OpenMIPS 的 int_i[0]，对应 Cause、Status 寄存器的第 10bit， 
+   所有外设中断都经过中断控制器 */ 
+#define PIC_INT_MASK        0x00000400 
+
+/* CP0 的时钟中断（Count 等于 Compare）连接到中断控制器的中断源 0，时钟节拍改用 
+   定时器之后不再使用，pic_init 之后一直屏蔽 */ 
+#define CP0_TIMER_PIC_SRC   0 
+
+/* 一些函数声明 */ 
+extern void pic_init(void);        /* 中断控制器初始化函数 */ 
+extern void pic_attach(INT8U src, INT8U prio, INT8U edge, void (*isr)(void)); 
+extern void pic_mask(INT8U src);   /* 屏蔽一个中断源 */ 
+extern void pic_unmask(INT8U src); /* 允许一个中断源 */ 
+extern void pic_dispatch(void);    /* 按优先级依次调用处理函数，由 BSP_Interrupt_Handler 调用 */ 
+
+/**************************************************************** 
+***********            第十段：与定时器有关的宏            ********** 
+*****************************************************************/ 
+
+#define TIMER_BASE          0x90000000   /* 定时器的起始地址 */ 
+#define TIMER_TS_LO_REG     0x00000000   /* 时间戳低 32 位，读它时锁存高 32 位 */ 
+#define TIMER_TS_HI_REG     0x00000004   /* 锁存的时间戳高 32 位 */ 
+#define TIMER_STATUS_REG    0x00000008   /* 各通道的到期标志，写 1 清零 */ 
+
+/* 通道 ch 的寄存器 */ 
+#define TIMER_CH_REG(ch, r) REG32(TIMER_BASE + 0x20 + (ch) * 0x20 + (r)) 
+#define TIMER_CTRL_REG      0x00000000   /* 控制寄存器 */ 
+#define TIMER_LOAD_LO_REG   0x00000004   /* 周期的低 32 位，单位是时钟周期 */ 
+#define TIMER_LOAD_HI_REG   0x00000008   /* 周期的高 32 位 */ 
+#define TIMER_COUNT_LO_REG  0x0000000C   /* 当前计数值的低 32 位，读它时锁存高 32 位 */ 
+#define TIMER_COUNT_HI_REG  0x00000010   /* 锁存的计数值高 32 位 */ 
+
+#define TIMER_CTRL_EN       0x01         /* 第 0bit 为 1 时计数，写 1 从 LOAD 重新开始 */ 
+#define TIMER_CTRL_ONESHOT  0x02         /* 第 1bit 为 1 时只到期一次，为 0 时周期运行 */ 
+#define TIMER_CTRL_IE       0x04         /* 第 2bit 为 1 时到期产生中断 */ 
+
+#define TIMER_CH_NUM        4            /* 通道数 */ 
+#define TIMER_CH_TICK       0            /* OS 时钟节拍使用的通道 */ 
+#define TIMER_CH_OSTMR      1            /* 软件定时器（OSTmr）使用的通道 */ 
+
+/* 通道 ch 的中断连接到中断控制器的中断源 4 + ch */ 
+#define TIMER_PIC_SRC(ch)   (4 + (ch)) 
+#define TICK_PIC_PRIO       3 
+#define OSTMR_PIC_PRIO      1 
+
+/* 一些函数声明 */ 
+extern void timer_init(void);      /* 停止所有通道 */ 
+extern void timer_start(INT8U ch, CPU_INT64U period, INT32U ctrl); /* 以 period 个周期启动通道 */ 
+extern void timer_stop(INT8U ch);  /* 停止通道 */ 
+extern void timer_ack(INT8U ch);   /* 清除通道的到期标志，在中断处理函数中调用 */ 
+extern CPU_INT64U timer_ts(void);  /* 读 64 位时间戳 */ 
+
+/**************************************************************** 
+***********          第十一段：与 CRC 计算单元有关的宏       ********** 
+*****************************************************************/ 
+
+#define CRC_BASE            0xA0000000   /* CRC 计算单元的起始地址 */ 
+#define CRC_CTRL_REG        0x00000000   /* 控制寄存器 */ 
+#define CRC_INIT_REG        0x00000004   /* 初值寄存器，复位后为 0xFFFFFFFF */ 
+#define CRC_STATE_REG       0x00000008   /* 当前的移位寄存器，可以读写 */ 
+#define CRC_RESULT_REG      0x0000000C   /* 计算结果 */ 
+#define CRC_DATA_REG        0x00000010   /* 数据窗口的起始地址，0x10 以上都是数据窗口 */ 
+
+#define CRC_CTRL_CRC16      0x01         /* 第 0bit 为 1 时计算 CRC-16/MODBUS，为 0 时计算 CRC-32 */ 
+#define CRC_CTRL_INIT       0x02         /* 写第 1bit 为 1 把移位寄存器设为初值 */ 
+
+#define CRC_DMA_MIN         64           /* 不少于这么多字节才用 DMA 送数据 */ 
+
+/* Flash 镜像头：BootLoader 区域末尾的 8 个字节，OS 长度之前 */ 
+#define IMG_MAGIC_ADDR      (FLASH_BASE + 0x2F8) 
+#define IMG_CRC_ADDR        (FLASH_BASE + 0x2FC) 
+#define IMG_MAGIC           0x43524332   /* "CRC2" */ 
+
+/* 一些函数声明。用 DMA 送数据时缓冲区不能放在 DTCM（任务堆栈）中。 
+   不能在中断服务程序中调用，否则直接返回 0 */ 
+extern void crc_init(void);        /* 需要在 OSInit、dma_init 之后调用 */ 
+extern INT32U crc32(const void *buf, INT32U len);  /* 与 zlib 的 crc32 相同 */ 
+extern INT16U crc16(const void *buf, INT32U len);  /* CRC-16/MODBUS */ 
+
+/**************************************************************** 
+***********              第十二段：就绪表                 ********** 
+*****************************************************************/ 
+
+/* 就绪表 wb_rdylist 的起始地址是 0xB0000000，只由内核使用，寄存器和访问它的宏定义在 
+   os_cpu.h 中，由 OS_CPU_RDY_METHOD 选择是否使用 */ 
+
+/**************************************************************** 
+***********            第十三段：调度延迟、中断开销测试       ********** 
+*****************************************************************/ 
+
+#define SCHED_BENCH_EN      0            /* 为 1 时 TaskStart 开始时先测一次调度延迟，只在比较时打开 */ 
+#define BENCH_PRIO          10           /* 测试用的低优先级任务 */ 
+#define BENCH_LOOPS         1000         /* 测量次数 */ 
+
+extern void sched_bench(void);     /* 测量信号量唤醒高优先级任务的延迟，通过 UART 输出 */ 
+
+#define ISR_BENCH_EN        0            /* 为 1 时 TaskStart 开始时测一次中断的开销，只在比较时打开 */ 
+#define ISR_BENCH_TICKS     100          /* 测量的中断次数，时钟节拍为 OS_TICKS_PER_SEC */ 
+#define ISR_BENCH_GAP       20           /* 时间戳间隔超过正常值这么多个周期才算被中断打断 */ 
+
+extern void isr_bench(void);       /* 测量不切换任务时一次中断的周期数，通过 UART 输出 */ 
 
 /**************************************************************** 
-***********           第五段：主函数 main 声明           ********** 
+***********          第十四段：主函数 main 声明          ********** 
 *****************************************************************/ 
 extern void main(void);
\ No newline at end of file
@@ -40,9 +40,9 @@ typedef float                       FP32;
 typedef double                      FP64;
 
 typedef unsigned  int               OS_STK;       /* Each stack entry is 32 bits wide 堆栈宽度是 32 位  */
-typedef unsigned  int  volatile     OS_CPU_SR;    /* The CPU Status Word is 32-bits wide. This variable*/
-                                                  /* MUST be volatile for proper operation.  Refer to  */
-                                                  /* os_cpu_a.s for more details.                      */
+typedef unsigned  int               OS_CPU_SR;    /* The CPU Status Word is 32-bits wide. The inline   */
+                                                  /* di/mtc0 below carry a "memory" clobber, so the    */
+                                                  /* variable no longer has to be volatile.            */
 // 某一处理器的编译器认为 int 是有符号 16 位整数，而不是 short，那么只需要
 // 将 INT16S 前面的的 short 改为 int 即可，不用修改 µC/OS-II 的其余代码，以此确保可移植性。
 /*
@@ -66,8 +66,21 @@ typedef unsigned  int  volatile     OS_CPU_SR;    /* The CPU Status Word is 32-b
 
 #define  OS_CRITICAL_METHOD    3
 /*************              进、出临界区的宏          ***************/ 
+/* OS_CPU_CRITICAL_INLINE 为 1 时用内联的 di、mtc0（MIPS32 Release 2），进、出临界区各两条指令，
+   不调用函数；为 0 时调用 os_cpu_a.S 中的 OS_CPU_SR_Save、OS_CPU_SR_Restore。
+   编译选项是 -mips32，汇编器不认识 di、ehb，用 .set mips32r2 临时打开，编译器仍然不会生成
+   处理器没有实现的其他 Release 2 指令。"memory" 让编译器不把存储器访问移出临界区 */
+#define  OS_CPU_CRITICAL_INLINE  1
+
+#if OS_CPU_CRITICAL_INLINE > 0
+#define  OS_ENTER_CRITICAL()   asm volatile(".set push\n\t.set mips32r2\n\tdi    %0\n\tehb\n\t.set pop" \
+                                            : "=r"(cpu_sr) : : "memory");
+#define  OS_EXIT_CRITICAL()    asm volatile(".set push\n\t.set mips32r2\n\tmtc0  %0,$12,0\n\tehb\n\t.set pop" \
+                                            : : "r"(cpu_sr) : "memory");
+#else
 #define  OS_ENTER_CRITICAL()   cpu_sr = OS_CPU_SR_Save();
 #define  OS_EXIT_CRITICAL()    OS_CPU_SR_Restore(cpu_sr);
+#endif
 
 /*
 ********************************************************************************************************* 
@@ -77,6 +90,89 @@ typedef unsigned  int  volatile     OS_CPU_SR;    /* The CPU Status Word is 32-b
 
 #define  OS_STK_GROWTH    1                       /* Stack grows from HIGH to LOW memory 堆栈生长方向              */
 #define  OS_TASK_SW()     asm("\tsyscall\n");     // 用于任务切换 从低优先级任务切换到高优先级任务 就是系统调用指令 syscall
+
+/*************   把函数或变量放到紧耦合存储器 TCM 中，段的位置见 ram.ld   ***************/
+#define  OS_ITCM          __attribute__((section(".itcm")))       /* 函数放到 ITCM，取指不经过总线       */
+#define  OS_DTCM          __attribute__((section(".dtcm")))       /* 有初值的变量放到 DTCM              */
+#define  OS_DTCM_BSS      __attribute__((section(".dtcm_bss")))   /* 无初值的变量（如任务堆栈）放到 DTCM */
+
+/*************      中断堆栈 OSCPUIntStk，定义在 os_cpu_a.S 中      ***************/
+#define  OS_CPU_INT_NEST_MAX  4u                  /* 中断嵌套的最大层数，与 os_cpu_a.S 的 INT_NEST_MAX 相同 */
+#define  OS_CPU_INT_STK_FILL  0xA5A5A5A5u         /* OSInitHookBegin 填入中断堆栈的值，用于检查使用量    */
+
+extern  INT32U  OSCPUIntStk[];                    /* 中断堆栈的最低地址                                  */
+extern  INT32U  OSCPUIntStkTop[];                 /* 中断堆栈的最高地址（不含）                          */
+OS_CPU_EXT  INT32U  OSCPUIntStkMax;               /* 统计任务记录的中断堆栈最大使用量，字节              */
+
+/*
+*********************************************************************************************************
+*                                   READY LIST 就绪表（见 ucos_ii.h 中的 READY LIST ACCESS）
+*
+* OS_CPU_RDY_METHOD 选择就绪表的实现：
+*   0  内核自己的 OSRdyGrp、OSRdyTbl[]，找最高优先级时查两次 OSUnMapTbl，都在 SDRAM 中
+*   1  总线上的就绪表 wb_rdylist（0xB0000000）：就绪、取消就绪各一次写，找最高优先级一次读，
+*      事件等待表的查找也用它的 UNMAP 窗口代替 OSUnMapTbl，只支持 64 个优先级
+*   2  DTCM 中的 64 位就绪位图 OSCPURdyMask[]，用 clz 指令找最高优先级和事件等待表中的最高
+*      优先级，不查 OSUnMapTbl，也不访问总线，只支持 64 个优先级
+* 内核源文件只包含 ucos_ii.h，不包含 openmips.h，所以寄存器在这里定义
+* 三种实现的调度延迟可以用 sched_bench（common/bench.c）比较
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_RDY_METHOD     2
+
+#if OS_CPU_RDY_METHOD == 1
+#if OS_LOWEST_PRIO > 63u
+#error  "OS_CPU.H, OS_CPU_RDY_METHOD 1 only supports OS_LOWEST_PRIO <= 63"
+#endif
+
+#define  OS_CPU_RDY_BASE       0xB0000000
+#define  OS_CPU_RDY_REG(r)     (*(volatile INT32U *)(OS_CPU_RDY_BASE + (r)))
+#define  OS_CPU_RDY_SET_REG    0x00000000      /* 写优先级，该优先级就绪                          */
+#define  OS_CPU_RDY_CLR_REG    0x00000004      /* 写优先级，该优先级不再就绪                      */
+#define  OS_CPU_RDY_HIGH_REG   0x00000008      /* 读出就绪的最高优先级                            */
+#define  OS_CPU_RDY_LO_REG     0x00000010      /* 优先级 0 ~ 31 的就绪位                          */
+#define  OS_CPU_RDY_HI_REG     0x00000014      /* 优先级 32 ~ 63 的就绪位                         */
+#define  OS_CPU_RDY_UNMAP_REG  0x00000400      /* 读 UNMAP + x * 4 与读 OSUnMapTbl[x] 相同        */
+
+#define  OS_RDY_INIT()                    (OS_CPU_RDY_REG(OS_CPU_RDY_LO_REG) = 0u, \
+                                           OS_CPU_RDY_REG(OS_CPU_RDY_HI_REG) = 0u)
+/* 只用到 prio，(void)(y) 避免调用处的 y 被编译器认为没有使用 */
+#define  OS_RDY_SET(prio, y, bitx, bity)  ((void)(y), OS_CPU_RDY_REG(OS_CPU_RDY_SET_REG) = (prio))
+#define  OS_RDY_CLR(prio, y, bitx, bity)  ((void)(y), OS_CPU_RDY_REG(OS_CPU_RDY_CLR_REG) = (prio))
+#define  OS_RDY_TST(prio, y, bitx)        ((OS_CPU_RDY_REG(OS_CPU_RDY_LO_REG + (((prio) >> 3u) & 0x4u)) \
+                                            >> ((prio) & 0x1Fu)) & 1u)
+#define  OS_RDY_HIGH()                    (OS_CPU_RDY_REG(OS_CPU_RDY_HIGH_REG) & 0x3Fu)
+#define  OS_UNMAP(x)                      ((INT8U)OS_CPU_RDY_REG(OS_CPU_RDY_UNMAP_REG + ((INT32U)(x) << 2u)))
+
+#elif OS_CPU_RDY_METHOD == 2
+#if OS_LOWEST_PRIO > 63u
+#error  "OS_CPU.H, OS_CPU_RDY_METHOD 2 only supports OS_LOWEST_PRIO <= 63"
+#endif
+
+/* 优先级 p 对应 OSCPURdyMask[p >> 5] 的第 31 - (p & 31) 位，这样 clz 的结果直接就是优先级 */
+OS_CPU_EXT  INT32U  OSCPURdyMask[2] OS_DTCM_BSS;
+
+static __inline__ INT32U OS_CPU_CntLeadZeros (INT32U val)   /* clz 指令，val 为 0 时结果为 32 */
+{
+    INT32U  nbr;
+
+    asm("clz    %0,%1" : "=r"(nbr) : "r"(val));
+    return (nbr);
+}
+
+#define  OS_CPU_RDY_BIT(prio)             (0x80000000u >> ((prio) & 0x1Fu))
+
+#define  OS_RDY_INIT()                    (OSCPURdyMask[0] = 0u, OSCPURdyMask[1] = 0u)
+#define  OS_RDY_SET(prio, y, bitx, bity)  ((void)(y), OSCPURdyMask[(prio) >> 5u] |=  OS_CPU_RDY_BIT(prio))
+#define  OS_RDY_CLR(prio, y, bitx, bity)  ((void)(y), OSCPURdyMask[(prio) >> 5u] &= ~OS_CPU_RDY_BIT(prio))
+#define  OS_RDY_TST(prio, y, bitx)        ((OSCPURdyMask[(prio) >> 5u] & OS_CPU_RDY_BIT(prio)) != 0u)
+/* 空闲任务总是就绪，两个字不会都为 0 */
+#define  OS_RDY_HIGH()                    ((OSCPURdyMask[0] != 0u) ? OS_CPU_CntLeadZeros(OSCPURdyMask[0]) \
+                                                                   : OS_CPU_CntLeadZeros(OSCPURdyMask[1]) + 32u)
+/* x & -x 只保留最低的 1，它的位置是 31 - clz。事件等待表只在不为 0 时查找 */
+#define  OS_UNMAP(x)                      ((INT8U)(31u - OS_CPU_CntLeadZeros((INT32U)(x) & (0u - (INT32U)(x)))))
+#endif
 					
 
 
@@ -86,17 +182,15 @@ typedef unsigned  int  volatile     OS_CPU_SR;    /* The CPU Status Word is 32-b
 *********************************************************************************************************
 */
 
-void       OSIntCtxSw(void);
+void       OSIntCtxSw(void);                   /* 只记下切换请求，由 InterruptHandler 完成切换         */
+void       OS_CPU_CtxSwRestore(void);          /* 现场已完整保存时切换到 OSTCBHighRdy，不返回         */
 void       OSStartHighRdy(void);
 void       ExceptionHandler(void);
 void       InterruptHandler(void);
 
-void       TickInterruptClear(void);
-void       CoreTmrInit(CPU_INT32U tmr_reload);
-void       TickISR(CPU_INT32U tmr_reload);
-
 OS_CPU_SR  OS_CPU_SR_Save(void);               /* See os_cpu_a.s                                       */
 void       OS_CPU_SR_Restore(OS_CPU_SR);       /* See os_cpu_a.s                                       */
+INT32U     OSCPUIntStkUsed(void);              /* 中断堆栈到目前为止的最大使用量，字节                 */
 
 
 
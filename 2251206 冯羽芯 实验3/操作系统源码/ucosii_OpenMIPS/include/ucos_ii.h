@@ -13,7 +13,7 @@
 * LICENSING TERMS:
 * ---------------
 *   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
-* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrim to properly license
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micri祄 to properly license
 * its use in your product. We provide ALL the source code for your convenience and to help you experience
 * uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
 * licensing fee.
@@ -726,6 +726,62 @@ OS_EXT  OS_TMR_WHEEL      OSTmrWheelTbl[OS_TMR_CFG_WHEEL_SIZE];
 
 extern  INT8U   const     OSUnMapTbl[256];          /* Priority->Index    lookup table                 */
 
+/*$PAGE*/
+/*
+*********************************************************************************************************
+*                                          READY LIST ACCESS
+*
+* Description: The kernel accesses the ready list only through the macros below.  By default they operate
+*              on OSRdyGrp/OSRdyTbl[].  A port may keep the ready list elsewhere (e.g. in hardware) by
+*              defining all of OS_RDY_INIT(), OS_RDY_SET(), OS_RDY_CLR() and OS_RDY_TST() in OS_CPU.H.
+*
+*              OS_RDY_INIT()                    Clear the ready list
+*              OS_RDY_SET(prio, y, bitx, bity)  Make priority 'prio' ready to run
+*              OS_RDY_CLR(prio, y, bitx, bity)  Make priority 'prio' not ready to run
+*              OS_RDY_TST(prio, y, bitx)        Non-zero if priority 'prio' is ready to run
+*
+*              'y', 'bitx' and 'bity' are the OSTCBY, OSTCBBitX and OSTCBBitY values for 'prio'.
+*
+*              The port may also define:
+*
+*              OS_RDY_HIGH()                    Highest priority ready to run, used by OS_SchedNew()
+*              OS_UNMAP(x)                      Same as OSUnMapTbl[x] for 0 <= x <= 255
+*
+* Note(s)    : These macros are always invoked with interrupts disabled.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_RDY_INIT
+#define  OS_RDY_INIT()                                                     \
+         do {                                                              \
+             INT8U  i_rdy;                                                 \
+             OSRdyGrp = 0u;                                                \
+             for (i_rdy = 0u; i_rdy < OS_RDY_TBL_SIZE; i_rdy++) {          \
+                 OSRdyTbl[i_rdy] = 0u;                                     \
+             }                                                             \
+         } while (0)
+
+#define  OS_RDY_SET(prio, y, bitx, bity)                                   \
+         do {                                                              \
+             OSRdyGrp    |= (bity);                                        \
+             OSRdyTbl[y] |= (bitx);                                        \
+         } while (0)
+
+#define  OS_RDY_CLR(prio, y, bitx, bity)                                   \
+         do {                                                              \
+             OSRdyTbl[y] &= (OS_PRIO)~(bitx);                              \
+             if (OSRdyTbl[y] == 0u) {                                      \
+                 OSRdyGrp &= (OS_PRIO)~(bity);                             \
+             }                                                             \
+         } while (0)
+
+#define  OS_RDY_TST(prio, y, bitx)      ((OSRdyTbl[y] & (bitx)) != 0u)
+#endif
+
+#ifndef  OS_UNMAP
+#define  OS_UNMAP(x)                    OSUnMapTbl[x]
+#endif
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -35,6 +35,13 @@
 #if OS_CPU_HOOKS_EN > 0 && OS_VERSION > 203
 void  OSInitHookBegin (void)
 {
+    INT32U  *p;
+
+    /* 中断还没有打开，中断堆栈还没有用过，填入 OS_CPU_INT_STK_FILL 供 OSCPUIntStkUsed 检查 */
+    for (p = OSCPUIntStk; p < OSCPUIntStkTop; p++) {
+        *p = OS_CPU_INT_STK_FILL;
+    }
+    OSCPUIntStkMax = 0u;
 }
 #endif
 
@@ -142,9 +149,41 @@ void  OSTaskIdleHook (void)
 #if OS_CPU_HOOKS_EN > 0
 void  OSTaskStatHook (void)
 {
+    INT32U  size;
+    INT32U  used;
+
+    size = (INT32U)OSCPUIntStkTop - (INT32U)OSCPUIntStk;
+    used = OSCPUIntStkUsed();
+    if (used >= size && OSCPUIntStkMax < size) {       /* 最低的字也被改写，很可能已经越界，只报告一次 */
+        uart_print_str("Interrupt stack overflow!\n");
+    }
+    OSCPUIntStkMax = used;
 }
 #endif
 
+/*
+*********************************************************************************************************
+*                                   INTERRUPT STACK HIGH-WATER MARK
+*
+* Description: 从中断堆栈的最低地址往上数，仍是 OS_CPU_INT_STK_FILL 的字没有被用过，返回其余部分的
+*              字节数，即到目前为止中断堆栈的最大使用量
+*
+* Arguments  : None
+*********************************************************************************************************
+*/
+
+INT32U  OSCPUIntStkUsed (void)
+{
+    INT32U  *p;
+
+    for (p = OSCPUIntStk; p < OSCPUIntStkTop; p++) {
+        if (*p != OS_CPU_INT_STK_FILL) {
+            break;
+        }
+    }
+    return ((INT32U)OSCPUIntStkTop - (INT32U)p);
+}
+
 /*
 *********************************************************************************************************
 *                                        INITIALIZE A TASK'S STACK
@@ -221,10 +260,10 @@ OS_STK  *OSTaskStkInit (void  (*task)(void *pd),
     (void)opt;                                 /* Prevent compiler warning for unused arguments        */              
 
     asm volatile("mfc0   %0,$12"   : "=r"(sr_val)); /* 获取Status寄存器的值 */
-    /* Status 寄存器的值保存在变量 sr_val 中，设置其第 10 位为 1，设置其第 0 位也 
-       为 1，sr_val 将作为新任务的对应 Status 寄存器的值，此处的设置就是使得新任 
-       务在执行时允许时钟中断 */
-    sr_val  |= 0x00000401;                     /* Initialize stack to allow for tick interrupt         */
+    /* Status 寄存器的值保存在变量 sr_val 中，设置其第 10 位为 1，设置其第 0 位 
+       也为 1，sr_val 将作为新任务的对应 Status 寄存器的值，此处的设置就是使得新任 
+       务在执行时允许中断控制器的中断，时钟、UART、GPIO、DMA 中断都经过中断控制器 */
+    sr_val  |= 0x00000001 | PIC_INT_MASK;      /* Initialize stack to allow for interrupt controller     */
 
     /* 下面的代码是为了获取全局寄存器 gp 的值，gp 寄存器的值保存在变量 gp_val 中 */
     asm volatile("addi   %0,$28,0" : "=r"(gp_val));
@@ -344,19 +383,15 @@ void  OSTimeTickHook (void)
 void  BSP_Interrupt_Handler (void)
 {
     INT32U   cause_val;
-    INT32U   cause_reg;
-    INT32U   cause_ip;
 
      /* 读取 Cause 寄存器，获得其中的 IP（Interrupt Pending）字段 */
     asm ("mfc0   %0,$13"   : "=r"(cause_val));
-    cause_reg  = cause_val;                     /* 得到 Exc Code        */
-    cause_ip = cause_reg & 0x0000FF00;
 
-    if((cause_ip & 0x00000400) != 0 )
+    if((cause_val & PIC_INT_MASK) != 0 )
     {
-    	/* 如果 IP 字段表示是时钟中断，那么调用函数 TickISR，在该函数中将 
-          Compare 寄存器增加 0x50000，同时清除时钟中断声明   */
-        TickISR(0x50000);
+        /* 所有中断都经过中断控制器，由 pic_dispatch 读 VECTOR 寄存器得到优先级最高的 
+           中断源，直接调用它的处理函数，高优先级的中断可以嵌套进来 */
+        pic_dispatch();
     }
 }
 
@@ -380,20 +415,21 @@ void  BSP_Exception_Handler (void)
     /* 读取 Cause 寄存器，获得其中的 ExcCode 字段，该字段存储的是异常原因 */
     asm volatile("mfc0   %0,$13"   : "=r"(cause_val));
     cause_exccode  = (cause_val & 0x0000007C);                     /* 得到 Exc Code        */
+    /* ExceptionHandler 已经保存完整的现场，直接切换到 OSTCBHighRdy，不返回 */
     if(cause_exccode == 0x00000020 )                             /* 判断是否是由于 syscall 指令引起 */
     {
-    	OSIntCtxSw();                                           
+    	OS_CPU_CtxSwRestore();                                           
     }
     else if(cause_exccode == 0x00000034)                         /* 判断是否是由于 Txx 指令引起 */
     {
-    	OSIntCtxSw();
+    	OS_CPU_CtxSwRestore();
     }
     else if(cause_exccode == 0x00000030)                         /* 判断是否是由于溢出引起 */
     {
-    	OSIntCtxSw();
+    	OS_CPU_CtxSwRestore();
     }
     else if(cause_exccode == 0x00000028)                          /* 判断是否是由于 invalid instruction 引起 */
     {
-        OSIntCtxSw();
+        OS_CPU_CtxSwRestore();
     } 
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+/****************************************************************
+***********   在 Flash 镜像 OS.bin 中写入镜像头的主机工具    **********
+*****************************************************************/
+/* 用法：imgcrc OS.bin
+ *
+ * OS.bin 由 BinMerge.exe 生成：0 ~ 0x2FF 为 BootLoader（其余字节为 0xFF），0x300 处为 OS 的
+ * 长度（大端），0x304 开始为 OS。本工具把文件补齐到 4 字节的整数倍（补 0xFF），然后在
+ * 0x2F8 处写入 IMG_MAGIC，在 0x2FC 处写入 OS 的 CRC-32（与 zlib 相同，大端）。CRC 覆盖
+ * 0x304 开始的 (长度 + 3) / 4 个字，与 BootLoader 用 DMA 送入 CRC 计算单元的范围相同 */
+#include <stdio.h>
+#include <stdlib.h>
+
+#define IMG_MAGIC_OFF   0x2F8
+#define IMG_CRC_OFF     0x2FC
+#define IMG_LEN_OFF     0x300
+#define IMG_OS_OFF      0x304
+#define IMG_MAGIC       0x43524332UL   /* "CRC2"，与 openmips.h 中的定义相同 */
+
+static unsigned long crc32_calc(const unsigned char *p, unsigned long n)
+{
+    unsigned long crc = 0xffffffffUL;
+    int k;
+
+    while(n-- > 0)
+    {
+        crc ^= *p++;
+        for(k = 0; k < 8; k++)
+            crc = (crc & 1) ? (crc >> 1) ^ 0xedb88320UL : crc >> 1;
+    }
+    return ~crc & 0xffffffffUL;
+}
+
+static unsigned long get_be32(const unsigned char *p)
+{
+    return ((unsigned long)p[0] << 24) | ((unsigned long)p[1] << 16) |
+           ((unsigned long)p[2] << 8)  |  (unsigned long)p[3];
+}
+
+static void put_be32(unsigned char *p, unsigned long v)
+{
+    p[0] = (unsigned char)(v >> 24);
+    p[1] = (unsigned char)(v >> 16);
+    p[2] = (unsigned char)(v >> 8);
+    p[3] = (unsigned char)v;
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *fp;
+    unsigned char *buf;
+    long size;
+    unsigned long len, words, crc;
+    int i;
+
+    if(argc != 2)
+    {
+        fprintf(stderr, "usage: %s OS.bin\n", argv[0]);
+        return 1;
+    }
+
+    fp = fopen(argv[1], "rb");
+    if(fp == NULL || fseek(fp, 0, SEEK_END) != 0 || (size = ftell(fp)) < IMG_OS_OFF)
+    {
+        fprintf(stderr, "%s: cannot read %s\n", argv[0], argv[1]);
+        return 1;
+    }
+    rewind(fp);
+
+    /* 多分配 4 个字节，用于补齐 */
+    buf = malloc(size + 4);
+    if(buf == NULL || fread(buf, 1, size, fp) != (size_t)size)
+    {
+        fprintf(stderr, "%s: cannot read %s\n", argv[0], argv[1]);
+        return 1;
+    }
+    fclose(fp);
+
+    /* 镜像头的位置应该是 BootLoader 之后补的 0xFF，已经写过镜像头的文件可以重新处理 */
+    for(i = IMG_MAGIC_OFF; i < IMG_LEN_OFF && get_be32(buf + IMG_MAGIC_OFF) != IMG_MAGIC; i++)
+    {
+        if(buf[i] != 0xff)
+        {
+            fprintf(stderr, "%s: BootLoader overlaps the image header at 0x%x\n", argv[0], i);
+            return 1;
+        }
+    }
+
+    while(size & 0x3)
+        buf[size++] = 0xff;
+
+    len   = get_be32(buf + IMG_LEN_OFF);
+    words = (len + 3) / 4;
+    if(IMG_OS_OFF + words * 4 > (unsigned long)size)
+    {
+        fprintf(stderr, "%s: OS length 0x%lx exceeds the file\n", argv[0], len);
+        return 1;
+    }
+
+    crc = crc32_calc(buf + IMG_OS_OFF, words * 4);
+    put_be32(buf + IMG_MAGIC_OFF, IMG_MAGIC);
+    put_be32(buf + IMG_CRC_OFF, crc);
+
+    fp = fopen(argv[1], "wb");
+    if(fp == NULL || fwrite(buf, 1, size, fp) != (size_t)size || fclose(fp) != 0)
+    {
+        fprintf(stderr, "%s: cannot write %s\n", argv[0], argv[1]);
+        return 1;
+    }
+    free(buf);
+
+    printf("%s: OS length 0x%lx, CRC-32 0x%08lx\n", argv[1], len, crc);
+    return 0;
+}
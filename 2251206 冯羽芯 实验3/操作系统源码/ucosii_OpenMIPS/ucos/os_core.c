@@ -14,7 +14,7 @@
 * LICENSING TERMS:
 * ---------------
 *   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
-* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrim to properly license
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micri祄 to properly license
 * its use in your product. We provide ALL the source code for your convenience and to help you experience
 * uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
 * licensing fee.
@@ -946,8 +946,8 @@ void  OSTimeTick (void)
                     }
 
                     if ((ptcb->OSTCBStat & OS_STAT_SUSPEND) == OS_STAT_RDY) {  /* Is task suspended?       */
-                        OSRdyGrp               |= ptcb->OSTCBBitY;             /* No,  Make ready          */
-                        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+                        OS_RDY_SET(ptcb->OSTCBPrio, ptcb->OSTCBY,              /* No,  Make ready          */
+                                   ptcb->OSTCBBitX, ptcb->OSTCBBitY);
                     }
                 }
             }
@@ -1040,20 +1040,20 @@ INT8U  OS_EventTaskRdy (OS_EVENT  *pevent,
 
 
 #if OS_LOWEST_PRIO <= 63u
-    y    = OSUnMapTbl[pevent->OSEventGrp];              /* Find HPT waiting for message                */
-    x    = OSUnMapTbl[pevent->OSEventTbl[y]];
+    y    = OS_UNMAP(pevent->OSEventGrp);                /* Find HPT waiting for message                */
+    x    = OS_UNMAP(pevent->OSEventTbl[y]);
     prio = (INT8U)((y << 3u) + x);                      /* Find priority of task getting the msg       */
 #else
     if ((pevent->OSEventGrp & 0xFFu) != 0u) {           /* Find HPT waiting for message                */
-        y = OSUnMapTbl[ pevent->OSEventGrp & 0xFFu];
+        y = OS_UNMAP( pevent->OSEventGrp & 0xFFu);
     } else {
-        y = OSUnMapTbl[(OS_PRIO)(pevent->OSEventGrp >> 8u) & 0xFFu] + 8u;
+        y = OS_UNMAP((OS_PRIO)(pevent->OSEventGrp >> 8u) & 0xFFu) + 8u;
     }
     ptbl = &pevent->OSEventTbl[y];
     if ((*ptbl & 0xFFu) != 0u) {
-        x = OSUnMapTbl[*ptbl & 0xFFu];
+        x = OS_UNMAP(*ptbl & 0xFFu);
     } else {
-        x = OSUnMapTbl[(OS_PRIO)(*ptbl >> 8u) & 0xFFu] + 8u;
+        x = OS_UNMAP((OS_PRIO)(*ptbl >> 8u) & 0xFFu) + 8u;
     }
     prio = (INT8U)((y << 4u) + x);                      /* Find priority of task getting the msg       */
 #endif
@@ -1069,8 +1069,7 @@ INT8U  OS_EventTaskRdy (OS_EVENT  *pevent,
     ptcb->OSTCBStatPend   =  pend_stat;                 /* Set pend status of post or abort            */
                                                         /* See if task is ready (could be susp'd)      */
     if ((ptcb->OSTCBStat &   OS_STAT_SUSPEND) == OS_STAT_RDY) {
-        OSRdyGrp         |=  ptcb->OSTCBBitY;           /* Put task in the ready to run list           */
-        OSRdyTbl[y]      |=  ptcb->OSTCBBitX;
+        OS_RDY_SET(prio, y, ptcb->OSTCBBitX, ptcb->OSTCBBitY); /* Put task in the ready to run list    */
     }
 
     OS_EventTaskRemove(ptcb, pevent);                   /* Remove this task from event   wait list     */
@@ -1111,10 +1110,7 @@ void  OS_EventTaskWait (OS_EVENT *pevent)
     pevent->OSEventGrp                   |= OSTCBCur->OSTCBBitY;
 
     y             =  OSTCBCur->OSTCBY;            /* Task no longer ready                              */
-    OSRdyTbl[y]  &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
-    if (OSRdyTbl[y] == 0u) {                      /* Clear event grp bit if this was only task pending */
-        OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
-    }
+    OS_RDY_CLR(OSTCBCur->OSTCBPrio, y, OSTCBCur->OSTCBBitX, OSTCBCur->OSTCBBitY);
 }
 #endif
 /*$PAGE*/
@@ -1154,10 +1150,7 @@ void  OS_EventTaskWaitMulti (OS_EVENT **pevents_wait)
     }
 
     y             =  OSTCBCur->OSTCBY;            /* Task no longer ready                              */
-    OSRdyTbl[y]  &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
-    if (OSRdyTbl[y] == 0u) {                      /* Clear event grp bit if this was only task pending */
-        OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
-    }
+    OS_RDY_CLR(OSTCBCur->OSTCBPrio, y, OSTCBCur->OSTCBBitX, OSTCBCur->OSTCBBitY);
 }
 #endif
 /*$PAGE*/
@@ -1366,13 +1359,7 @@ static  void  OS_InitMisc (void)
 
 static  void  OS_InitRdyList (void)
 {
-    INT8U  i;
-
-
-    OSRdyGrp      = 0u;                                    /* Clear the ready list                     */
-    for (i = 0u; i < OS_RDY_TBL_SIZE; i++) {
-        OSRdyTbl[i] = 0u;
-    }
+    OS_RDY_INIT();                                         /* Clear the ready list                     */
 
     OSPrioCur     = 0u;
     OSPrioHighRdy = 0u;
@@ -1671,27 +1658,29 @@ void  OS_Sched (void)
 
 static  void  OS_SchedNew (void)
 {
-#if OS_LOWEST_PRIO <= 63u                        /* See if we support up to 64 tasks                   */
+#if defined(OS_RDY_HIGH)                         /* See if the port resolves the highest priority      */
+    OSPrioHighRdy = (INT8U)OS_RDY_HIGH();
+#elif OS_LOWEST_PRIO <= 63u                      /* See if we support up to 64 tasks                   */
     INT8U   y;
 
 
-    y             = OSUnMapTbl[OSRdyGrp];
-    OSPrioHighRdy = (INT8U)((y << 3u) + OSUnMapTbl[OSRdyTbl[y]]);
+    y             = OS_UNMAP(OSRdyGrp);
+    OSPrioHighRdy = (INT8U)((y << 3u) + OS_UNMAP(OSRdyTbl[y]));
 #else                                            /* We support up to 256 tasks                         */
     INT8U     y;
     OS_PRIO  *ptbl;
 
 
     if ((OSRdyGrp & 0xFFu) != 0u) {
-        y = OSUnMapTbl[OSRdyGrp & 0xFFu];
+        y = OS_UNMAP(OSRdyGrp & 0xFFu);
     } else {
-        y = OSUnMapTbl[(OS_PRIO)(OSRdyGrp >> 8u) & 0xFFu] + 8u;
+        y = OS_UNMAP((OS_PRIO)(OSRdyGrp >> 8u) & 0xFFu) + 8u;
     }
     ptbl = &OSRdyTbl[y];
     if ((*ptbl & 0xFFu) != 0u) {
-        OSPrioHighRdy = (INT8U)((y << 4u) + OSUnMapTbl[(*ptbl & 0xFFu)]);
+        OSPrioHighRdy = (INT8U)((y << 4u) + OS_UNMAP(*ptbl & 0xFFu));
     } else {
-        OSPrioHighRdy = (INT8U)((y << 4u) + OSUnMapTbl[(OS_PRIO)(*ptbl >> 8u) & 0xFFu] + 8u);
+        OSPrioHighRdy = (INT8U)((y << 4u) + OS_UNMAP((OS_PRIO)(*ptbl >> 8u) & 0xFFu) + 8u);
     }
 #endif
 }
@@ -2016,8 +2005,7 @@ INT8U  OS_TCBInit (INT8U    prio,
             OSTCBList->OSTCBPrev = ptcb;
         }
         OSTCBList               = ptcb;
-        OSRdyGrp               |= ptcb->OSTCBBitY;         /* Make task ready to run                   */
-        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+        OS_RDY_SET(prio, ptcb->OSTCBY, ptcb->OSTCBBitX, ptcb->OSTCBBitY); /* Make task ready to run    */
         OSTaskCtr++;                                       /* Increment the #tasks counter             */
         OS_EXIT_CRITICAL();
         return (OS_ERR_NONE);
@@ -14,7 +14,7 @@
 * LICENSING TERMS:
 * ---------------
 *   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
-* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrim to properly license
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micri祄 to properly license
 * its use in your product. We provide ALL the source code for your convenience and to help you experience
 * uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
 * licensing fee.
@@ -1051,10 +1051,7 @@ static  void  OS_FlagBlock (OS_FLAG_GRP  *pgrp,
     pgrp->OSFlagWaitList = (void *)pnode;
 
     y            =  OSTCBCur->OSTCBY;                 /* Suspend current task until flag(s) received   */
-    OSRdyTbl[y] &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
-    if (OSRdyTbl[y] == 0x00u) {
-        OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
-    }
+    OS_RDY_CLR(OSTCBCur->OSTCBPrio, y, OSTCBCur->OSTCBBitX, OSTCBCur->OSTCBBitY);
 }
 
 /*$PAGE*/
@@ -1150,8 +1147,8 @@ static  BOOLEAN  OS_FlagTaskRdy (OS_FLAG_NODE *pnode,
     ptcb->OSTCBStat     &= (INT8U)~(INT8U)OS_STAT_FLAG;
     ptcb->OSTCBStatPend  = OS_STAT_PEND_OK;
     if (ptcb->OSTCBStat == OS_STAT_RDY) {                  /* Task now ready?                          */
-        OSRdyGrp               |= ptcb->OSTCBBitY;         /* Put task into ready list                 */
-        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+        OS_RDY_SET(ptcb->OSTCBPrio, ptcb->OSTCBY,          /* Put task into ready list                 */
+                   ptcb->OSTCBBitX, ptcb->OSTCBBitY);
         sched                   = OS_TRUE;
     } else {
         sched                   = OS_FALSE;
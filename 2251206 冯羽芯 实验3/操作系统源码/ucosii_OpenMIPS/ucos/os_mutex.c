@@ -14,7 +14,7 @@
 * LICENSING TERMS:
 * ---------------
 *   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
-* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrim to properly license
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micri祄 to properly license
 * its use in your product. We provide ALL the source code for your convenience and to help you experience
 * uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
 * licensing fee.
@@ -473,11 +473,9 @@ void  OSMutexPend (OS_EVENT  *pevent,
     if (ptcb->OSTCBPrio > pip) {                                  /*     Need to promote prio of owner?*/
         if (mprio > OSTCBCur->OSTCBPrio) {
             y = ptcb->OSTCBY;
-            if ((OSRdyTbl[y] & ptcb->OSTCBBitX) != 0u) {          /*     See if mutex owner is ready   */
-                OSRdyTbl[y] &= (OS_PRIO)~ptcb->OSTCBBitX;         /*     Yes, Remove owner from Rdy ...*/
-                if (OSRdyTbl[y] == 0u) {                          /*          ... list at current prio */
-                    OSRdyGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
-                }
+            if (OS_RDY_TST(ptcb->OSTCBPrio, y, ptcb->OSTCBBitX)) { /*    See if mutex owner is ready   */
+                OS_RDY_CLR(ptcb->OSTCBPrio, y,                    /*     Yes, Remove owner from Rdy ...*/
+                           ptcb->OSTCBBitX, ptcb->OSTCBBitY);     /*          ... list at current prio */
                 rdy = OS_TRUE;
             } else {
                 pevent2 = ptcb->OSTCBEventPtr;
@@ -502,8 +500,8 @@ void  OSMutexPend (OS_EVENT  *pevent,
             ptcb->OSTCBBitX = (OS_PRIO)(1uL << ptcb->OSTCBX);
 
             if (rdy == OS_TRUE) {                          /* If task was ready at owner's priority ...*/
-                OSRdyGrp               |= ptcb->OSTCBBitY; /* ... make it ready at new priority.       */
-                OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+                OS_RDY_SET(pip, ptcb->OSTCBY,              /* ... make it ready at new priority.       */
+                           ptcb->OSTCBBitX, ptcb->OSTCBBitY);
             } else {
                 pevent2 = ptcb->OSTCBEventPtr;
                 if (pevent2 != (OS_EVENT *)0) {            /* Add to event wait list                   */
@@ -709,10 +707,7 @@ static  void  OSMutex_RdyAtPrio (OS_TCB  *ptcb,
 
 
     y            =  ptcb->OSTCBY;                          /* Remove owner from ready list at 'pip'    */
-    OSRdyTbl[y] &= (OS_PRIO)~ptcb->OSTCBBitX;
-    if (OSRdyTbl[y] == 0u) {
-        OSRdyGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
-    }
+    OS_RDY_CLR(ptcb->OSTCBPrio, y, ptcb->OSTCBBitX, ptcb->OSTCBBitY);
     ptcb->OSTCBPrio         = prio;
     OSPrioCur               = prio;                        /* The current task is now at this priority */
 #if OS_LOWEST_PRIO <= 63u
@@ -724,8 +719,8 @@ static  void  OSMutex_RdyAtPrio (OS_TCB  *ptcb,
 #endif
     ptcb->OSTCBBitY         = (OS_PRIO)(1uL << ptcb->OSTCBY);
     ptcb->OSTCBBitX         = (OS_PRIO)(1uL << ptcb->OSTCBX);
-    OSRdyGrp               |= ptcb->OSTCBBitY;             /* Make task ready at original priority     */
-    OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+    OS_RDY_SET(prio, ptcb->OSTCBY,                         /* Make task ready at original priority     */
+               ptcb->OSTCBBitX, ptcb->OSTCBBitY);
     OSTCBPrioTbl[prio]      = ptcb;
 
 }
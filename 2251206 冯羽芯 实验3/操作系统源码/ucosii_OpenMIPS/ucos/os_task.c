@@ -14,7 +14,7 @@
 * LICENSING TERMS:
 * ---------------
 *   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
-* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrim to properly license
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micri祄 to properly license
 * its use in your product. We provide ALL the source code for your convenience and to help you experience
 * uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
 * licensing fee.
@@ -113,13 +113,9 @@ INT8U  OSTaskChangePrio (INT8U  oldprio,
     y_old                 =  ptcb->OSTCBY;
     bity_old              =  ptcb->OSTCBBitY;
     bitx_old              =  ptcb->OSTCBBitX;
-    if ((OSRdyTbl[y_old] &   bitx_old) != 0u) {             /* If task is ready make it not            */
-         OSRdyTbl[y_old] &= (OS_PRIO)~bitx_old;
-         if (OSRdyTbl[y_old] == 0u) {
-             OSRdyGrp &= (OS_PRIO)~bity_old;
-         }
-         OSRdyGrp        |= bity_new;                       /* Make new priority ready to run          */
-         OSRdyTbl[y_new] |= bitx_new;
+    if (OS_RDY_TST(oldprio, y_old, bitx_old)) {             /* If task is ready make it not            */
+         OS_RDY_CLR(oldprio, y_old, bitx_old, bity_old);
+         OS_RDY_SET(newprio, y_new, bitx_new, bity_new);    /* Make new priority ready to run          */
     }
 
 #if (OS_EVENT_EN)
@@ -465,10 +461,8 @@ INT8U  OSTaskDel (INT8U prio)
         return (OS_ERR_TASK_DEL);
     }
 
-    OSRdyTbl[ptcb->OSTCBY] &= (OS_PRIO)~ptcb->OSTCBBitX;
-    if (OSRdyTbl[ptcb->OSTCBY] == 0u) {                 /* Make task not ready                         */
-        OSRdyGrp           &= (OS_PRIO)~ptcb->OSTCBBitY;
-    }
+    OS_RDY_CLR(prio, ptcb->OSTCBY,                      /* Make task not ready                         */
+               ptcb->OSTCBBitX, ptcb->OSTCBBitY);
 
 #if (OS_EVENT_EN)
     if (ptcb->OSTCBEventPtr != (OS_EVENT *)0) {
@@ -820,8 +814,8 @@ INT8U  OSTaskResume (INT8U prio)
         ptcb->OSTCBStat &= (INT8U)~(INT8U)OS_STAT_SUSPEND;    /* Remove suspension                     */
         if (ptcb->OSTCBStat == OS_STAT_RDY) {                 /* See if task is now ready              */
             if (ptcb->OSTCBDly == 0u) {
-                OSRdyGrp               |= ptcb->OSTCBBitY;    /* Yes, Make task ready to run           */
-                OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+                OS_RDY_SET(prio, ptcb->OSTCBY,                /* Yes, Make task ready to run           */
+                           ptcb->OSTCBBitX, ptcb->OSTCBBitY);
                 OS_EXIT_CRITICAL();
                 if (OSRunning == OS_TRUE) {
                     OS_Sched();                               /* Find new highest priority task        */
@@ -984,10 +978,7 @@ INT8U  OSTaskSuspend (INT8U prio)
         return (OS_ERR_TASK_NOT_EXIST);
     }
     y            = ptcb->OSTCBY;
-    OSRdyTbl[y] &= (OS_PRIO)~ptcb->OSTCBBitX;                   /* Make task not ready                 */
-    if (OSRdyTbl[y] == 0u) {
-        OSRdyGrp &= (OS_PRIO)~ptcb->OSTCBBitY;
-    }
+    OS_RDY_CLR(prio, y, ptcb->OSTCBBitX, ptcb->OSTCBBitY);     /* Make task not ready                 */
     ptcb->OSTCBStat |= OS_STAT_SUSPEND;                         /* Status of task is 'SUSPENDED'       */
     OS_EXIT_CRITICAL();
     if (self == OS_TRUE) {                                      /* Context switch only if SELF         */
@@ -14,7 +14,7 @@
 * LICENSING TERMS:
 * ---------------
 *   uC/OS-II is provided in source form for FREE evaluation, for educational use or for peaceful research.
-* If you plan on using  uC/OS-II  in a commercial product you need to contact Micrim to properly license
+* If you plan on using  uC/OS-II  in a commercial product you need to contact Micri祄 to properly license
 * its use in your product. We provide ALL the source code for your convenience and to help you experience
 * uC/OS-II.   The fact that the  source is provided does  NOT  mean that you can use it without  paying a
 * licensing fee.
@@ -59,10 +59,7 @@ void  OSTimeDly (INT32U ticks)
     if (ticks > 0u) {                            /* 0 means no delay!                                  */
         OS_ENTER_CRITICAL();
         y            =  OSTCBCur->OSTCBY;        /* Delay current task                                 */
-        OSRdyTbl[y] &= (OS_PRIO)~OSTCBCur->OSTCBBitX;
-        if (OSRdyTbl[y] == 0u) {
-            OSRdyGrp &= (OS_PRIO)~OSTCBCur->OSTCBBitY;
-        }
+        OS_RDY_CLR(OSTCBCur->OSTCBPrio, y, OSTCBCur->OSTCBBitX, OSTCBCur->OSTCBBitY);
         OSTCBCur->OSTCBDly = ticks;              /* Load ticks in TCB                                  */
         OS_EXIT_CRITICAL();
         OS_Sched();                              /* Find next task to run!                             */
@@ -194,8 +191,8 @@ INT8U  OSTimeDlyResume (INT8U prio)
         ptcb->OSTCBStatPend  =  OS_STAT_PEND_OK;
     }
     if ((ptcb->OSTCBStat & OS_STAT_SUSPEND) == OS_STAT_RDY) {  /* Is task suspended?                   */
-        OSRdyGrp               |= ptcb->OSTCBBitY;             /* No,  Make ready                      */
-        OSRdyTbl[ptcb->OSTCBY] |= ptcb->OSTCBBitX;
+        OS_RDY_SET(prio, ptcb->OSTCBY,                         /* No,  Make ready                      */
+                   ptcb->OSTCBBitX, ptcb->OSTCBBitY);
         OS_EXIT_CRITICAL();
         OS_Sched();                                            /* See if this is new highest priority  */
     } else {